@@ -0,0 +1,85 @@
+// Order-id map under book-like churn: FlatHashMap vs std::unordered_map
+//
+// A steady population of live orders; each step adds one order, looks up two
+// live ones (executions / amends) and cancels a random live one.
+
+#include "flat_hash_map.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace execution;
+
+namespace {
+
+struct Record {
+    int64_t price;
+    uint32_t quantity;
+    uint32_t side;
+};
+
+struct FlatAdapter {
+    FlatHashMap<Record> map;
+    void add(uint64_t id, const Record& r) { map.insert(id, r); }
+    Record* find(uint64_t id) { return map.find(id); }
+    void cancel(uint64_t id) { map.erase(id); }
+};
+
+struct StdAdapter {
+    std::unordered_map<uint64_t, Record> map;
+    void add(uint64_t id, const Record& r) { map.emplace(id, r); }
+    Record* find(uint64_t id) {
+        auto it = map.find(id);
+        return it == map.end() ? nullptr : &it->second;
+    }
+    void cancel(uint64_t id) { map.erase(id); }
+};
+
+template <typename Map>
+double churn_ns_per_step(size_t live_orders, size_t steps) {
+    Map m;
+    std::vector<uint64_t> live;
+    live.reserve(live_orders);
+    uint64_t next_id = 1;
+    for (size_t i = 0; i < live_orders; ++i) {
+        m.add(next_id, Record{100, 100, 0});
+        live.push_back(next_id++);
+    }
+
+    std::mt19937_64 rng(1);
+    uint64_t checksum = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t s = 0; s < steps; ++s) {
+        m.add(next_id, Record{static_cast<int64_t>(s), 100, 1});
+        live.push_back(next_id++);
+        for (int k = 0; k < 2; ++k) {
+            Record* r = m.find(live[rng() % live.size()]);
+            checksum += r ? r->quantity : 0;
+        }
+        size_t victim = rng() % live.size();
+        m.cancel(live[victim]);
+        live[victim] = live.back();
+        live.pop_back();
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    if (checksum == 42) {
+        std::printf(" ");
+    }
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / steps;
+}
+
+} // namespace
+
+int main() {
+    const size_t steps = 2'000'000;
+    std::printf("%-12s %16s %20s %9s\n", "live orders", "FlatHashMap ns", "unordered_map ns", "speedup");
+    for (size_t live : {1'000, 100'000, 1'000'000, 4'000'000}) {
+        double flat = churn_ns_per_step<FlatAdapter>(live, steps);
+        double std_map = churn_ns_per_step<StdAdapter>(live, steps);
+        std::printf("%-12zu %16.1f %20.1f %8.2fx\n", live, flat, std_map, std_map / flat);
+    }
+    return 0;
+}
@@ -0,0 +1,112 @@
+// ITCH decode and book-replay throughput, single-threaded
+//
+// A synthetic stream is encoded in memory with ItchWriter: adds spread over
+// 64 locates, each followed later by an execute, partial cancel, replace or
+// delete of a live order. It is then parsed twice per round, once into a
+// handler that only sums fields (decode cost) and once into ItchBookReplay.
+
+#include "itch_parser.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace execution;
+
+namespace {
+
+// Touches every decoded message so nothing is optimized out
+struct DecodeOnly {
+    uint64_t checksum = 0;
+
+    void on_add(const ItchAdd& m) { checksum += m.order_ref + m.price; }
+    void on_execute(const ItchExecute& m) { checksum += m.order_ref + m.shares; }
+    void on_cancel(const ItchCancel& m) { checksum += m.order_ref + m.shares; }
+    void on_delete(const ItchDelete& m) { checksum += m.order_ref; }
+    void on_replace(const ItchReplace& m) { checksum += m.new_ref + m.price; }
+};
+
+std::vector<uint8_t> make_stream(size_t num_messages) {
+    ItchWriter writer;
+    std::mt19937_64 rng(11);
+    struct Live {
+        uint16_t locate;
+        uint64_t ref;
+    };
+    std::vector<Live> live;
+    uint64_t next_ref = 1;
+    uint64_t ts = 34'200'000'000'000;
+
+    for (size_t i = 0; i < num_messages; ++i) {
+        ts += 1'000;
+        if (live.size() < 1'000 || rng() % 2 == 0) {
+            uint16_t locate = static_cast<uint16_t>(rng() % 64);
+            Side side = rng() % 2 ? Side::Buy : Side::Sell;
+            uint32_t price = 1'000'000 + static_cast<uint32_t>(rng() % 200) * 100;
+            writer.add(locate, ts, next_ref, side, 100 * (1 + rng() % 10), price, "SPY");
+            live.push_back({locate, next_ref++});
+            continue;
+        }
+        size_t k = rng() % live.size();
+        Live order = live[k];
+        switch (rng() % 4) {
+        case 0:
+            writer.execute(order.locate, ts, order.ref, 100, i);
+            break;
+        case 1:
+            writer.cancel(order.locate, ts, order.ref, 100);
+            break;
+        case 2:
+            writer.replace(order.locate, ts, order.ref, next_ref, 200, 1'000'000 + static_cast<uint32_t>(rng() % 200) * 100);
+            live[k].ref = next_ref++;
+            break;
+        default:
+            writer.remove(order.locate, ts, order.ref);
+            live[k] = live.back();
+            live.pop_back();
+            break;
+        }
+    }
+    return writer.bytes();
+}
+
+template <typename Fn>
+double best_seconds(int rounds, Fn&& fn) {
+    double best = 1e30;
+    for (int r = 0; r < rounds; ++r) {
+        auto t0 = std::chrono::steady_clock::now();
+        fn();
+        auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+    }
+    return best;
+}
+
+} // namespace
+
+int main() {
+    std::printf("%-10s %10s %12s %14s %14s %16s\n", "messages", "MB", "decode GB/s", "decode Mmsg/s", "replay Mmsg/s", "checksum");
+    for (size_t n : {100'000, 1'000'000, 4'000'000}) {
+        std::vector<uint8_t> stream = make_stream(n);
+
+        uint64_t checksum = 0;
+        double decode = best_seconds(5, [&] {
+            DecodeOnly handler;
+            parse_itch(stream.data(), stream.size(), handler);
+            checksum = handler.checksum;
+        });
+        size_t unknown = 0;
+        double replay = best_seconds(3, [&] {
+            ItchBookReplay books;
+            parse_itch(stream.data(), stream.size(), books);
+            unknown = books.unknown_refs();
+        });
+
+        std::printf("%-10zu %10.1f %12.2f %14.1f %14.1f %16llx\n", n, stream.size() / 1e6,
+                    stream.size() / decode / 1e9, n / decode / 1e6, n / replay / 1e6,
+                    static_cast<unsigned long long>(checksum ^ unknown));
+    }
+    return 0;
+}
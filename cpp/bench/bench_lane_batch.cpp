@@ -0,0 +1,84 @@
+// Short-window batch evaluation: one order at a time vs 4 / 8 / 16 orders per lane group
+//
+// Single thread, 1M orders at random starts over ten years of daily data (the
+// size the batch / analytics paths run on; it stays in L2, so this measures
+// arithmetic, not cache misses). "scalar" runs twap_avg_price + vwap_avg_price
+// per order, i.e. the loop the batch paths use.
+
+#include "lane_batch.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace execution;
+
+namespace {
+
+double best_ms(int reps, auto&& fn) {
+    double best = 1e300;
+    for (int rep = 0; rep < reps; ++rep) {
+        auto t0 = std::chrono::steady_clock::now();
+        fn();
+        auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(t1 - t0).count());
+    }
+    return best;
+}
+
+} // namespace
+
+int main() {
+    const size_t n = 2520;
+    const size_t num_orders = 1'000'000;
+    std::vector<double> prices(n);
+    std::vector<double> volumes(n);
+    std::mt19937_64 rng(5);
+    std::normal_distribution<double> ret(0.0, 0.01);
+    double p = 100.0;
+    for (size_t i = 0; i < n; ++i) {
+        p *= std::exp(ret(rng));
+        prices[i] = p;
+        volumes[i] = 1e5 + static_cast<double>(rng() % 100'000);
+    }
+
+    std::printf("%-8s %12s %12s %12s %12s\n", "slices", "scalar Mo/s", "x4 Mo/s", "x8 Mo/s", "x16 Mo/s");
+    double checksum = 0.0;     // every output, printed, so no timed loop can be dropped
+    for (size_t num_slices : {5, 10, 20, 50, 200}) {
+        std::vector<size_t> starts(num_orders);
+        for (size_t& s : starts) {
+            s = rng() % (n - num_slices + 1);
+        }
+
+        std::vector<double> twap(num_orders), vwap(num_orders);
+        double scalar_ms = best_ms(3, [&] {
+            for (size_t i = 0; i < num_orders; ++i) {
+                const double* pw = prices.data() + starts[i];
+                twap[i] = slippage_bps(twap_avg_price(pw, num_slices), pw[0]);
+                vwap[i] = slippage_bps(vwap_avg_price(pw, volumes.data() + starts[i], num_slices), pw[0]);
+            }
+        });
+
+        // Kernels only, same preallocated outputs as the scalar loop
+        auto lanes = [&]<size_t L>() {
+            return best_ms(3, [&] {
+                for (size_t i = 0; i + L <= num_orders; i += L) {
+                    twap_vwap_lanes<L>(prices.data(), volumes.data(), starts.data() + i, num_slices, 1.0,
+                                       twap.data() + i, vwap.data() + i);
+                }
+            });
+        };
+        double lane_ms[3] = {lanes.template operator()<4>(), lanes.template operator()<8>(),
+                             lanes.template operator()<16>()};
+        for (size_t i = 0; i < num_orders; ++i) {
+            checksum += twap[i] + vwap[i];
+        }
+        std::printf("%-8zu %12.1f %12.1f %12.1f %12.1f\n", num_slices, num_orders / scalar_ms / 1e3,
+                    num_orders / lane_ms[0] / 1e3, num_orders / lane_ms[1] / 1e3, num_orders / lane_ms[2] / 1e3);
+    }
+    std::printf("checksum %.6g\n", checksum);
+    return 0;
+}
@@ -0,0 +1,80 @@
+// MLP inference: one decision per predict() call vs predict_batch() over n rows
+//
+// Policy-sized network (4 features -> 32 tanh -> 32 relu -> 1 sigmoid, the
+// shape mlp_policy runs in the execution loop), single thread, best of 5.
+// "single" is the per-slice latency the order loop pays; the batch rows are the
+// lane-tiled path the batched backtest uses, at a few batch sizes.
+
+#include "mlp_model.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace execution;
+
+namespace {
+
+double best_ms(int reps, auto&& fn) {
+    double best = 1e300;
+    for (int rep = 0; rep < reps; ++rep) {
+        auto t0 = std::chrono::steady_clock::now();
+        fn();
+        auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(t1 - t0).count());
+    }
+    return best;
+}
+
+DenseLayer random_layer(size_t in, size_t out, Activation activation, std::mt19937_64& rng) {
+    std::normal_distribution<float> w(0.0f, 0.5f);
+    DenseLayer layer{in, out, activation, std::vector<float>(in * out), std::vector<float>(out)};
+    for (float& v : layer.weights) v = w(rng);
+    for (float& v : layer.bias) v = 0.1f * w(rng);
+    return layer;
+}
+
+} // namespace
+
+int main() {
+    std::mt19937_64 rng(11);
+    std::vector<DenseLayer> layers;
+    layers.push_back(random_layer(4, 32, Activation::Tanh, rng));
+    layers.push_back(random_layer(32, 32, Activation::Relu, rng));
+    layers.push_back(random_layer(32, 1, Activation::Sigmoid, rng));
+    MLPModel model(std::move(layers));
+
+    const size_t num_rows = 1 << 20;
+    std::vector<float> x(num_rows * model.input_dim());
+    std::uniform_real_distribution<float> feature(-1.0f, 1.0f);
+    for (float& v : x) v = feature(rng);
+    std::vector<float> out(num_rows);
+
+    double checksum = 0.0;     // every output, printed, so no timed loop can be dropped
+    double single_ms = best_ms(5, [&] {
+        for (size_t i = 0; i < num_rows; ++i) {
+            out[i] = model.predict(x.data() + i * 4);
+        }
+    });
+    for (float v : out) checksum += v;
+
+    std::printf("%-14s %10s %12s\n", "path", "ns/row", "Mrows/s");
+    std::printf("%-14s %10.1f %12.2f\n", "single", single_ms * 1e6 / num_rows, num_rows / single_ms / 1e3);
+
+    for (size_t batch : {size_t{8}, size_t{64}, size_t{1024}, num_rows}) {
+        double ms = best_ms(5, [&] {
+            for (size_t r0 = 0; r0 < num_rows; r0 += batch) {
+                size_t m = std::min(batch, num_rows - r0);
+                model.predict_batch(x.data() + r0 * 4, m, out.data() + r0);
+            }
+        });
+        for (float v : out) checksum += v;
+        char label[32];
+        std::snprintf(label, sizeof(label), "batch %zu", batch);
+        std::printf("%-14s %10.1f %12.2f\n", label, ms * 1e6 / num_rows, num_rows / ms / 1e3);
+    }
+    std::printf("checksum %.6g\n", checksum);
+    return 0;
+}
@@ -0,0 +1,117 @@
+// Execution-report throughput of the OMS, single-threaded
+//
+// Parents are cut into children, each child is acked, partially filled twice
+// and then filled or cancelled; the report stream is built up front (child
+// ids are known from send order), interleaved across children, and replayed
+// through OrderManager::apply.
+//
+// Second table: kill-switch trigger to the last Cancel appended by
+// cancel_all, with every child acked and working.
+
+#include "oms.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace execution;
+
+namespace {
+
+struct RoundResult {
+    double reports_per_sec;
+    uint64_t reports;
+};
+
+RoundResult run_round(size_t num_parents, size_t children_per_parent) {
+    OrderManager oms(num_parents, num_parents * children_per_parent, num_parents * children_per_parent * 3);
+    std::vector<ExecutionReport> reports;
+    reports.reserve(num_parents * children_per_parent * 4);
+    std::vector<uint64_t> parent_ids;
+    parent_ids.reserve(num_parents);
+
+    std::mt19937_64 rng(7);
+    for (size_t p = 0; p < num_parents; ++p) {
+        ParentOrder* parent = oms.new_parent(p % 2 ? Side::Buy : Side::Sell,
+                                             static_cast<uint32_t>(children_per_parent * 300));
+        parent_ids.push_back(parent->id);
+        for (size_t c = 0; c < children_per_parent; ++c) {
+            int64_t price = 10'000 + static_cast<int64_t>(rng() % 64);
+            ChildOrder* child = oms.send_child(parent->id, price, 300);
+            reports.push_back({child->id, ReportType::Ack, 0, 0, 0});
+            reports.push_back({child->id, ReportType::Fill, 100, price, 1});
+            reports.push_back({child->id, ReportType::Fill, 100, price, 2});
+            reports.push_back(rng() % 4 == 0 ? ExecutionReport{child->id, ReportType::Cancel, 0, 0, 3}
+                                             : ExecutionReport{child->id, ReportType::Fill, 100, price, 3});
+        }
+    }
+    // Interleave children as a venue would
+    std::shuffle(reports.begin(), reports.end(), rng);
+    std::stable_sort(reports.begin(), reports.end(),
+                     [](const ExecutionReport& a, const ExecutionReport& b) { return a.timestamp < b.timestamp; });
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (const ExecutionReport& r : reports) {
+        oms.apply(r);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+
+    for (uint64_t id : parent_ids) {
+        oms.cancel_parent(id);
+        oms.release_parent(id);
+    }
+    double secs = std::chrono::duration<double>(t1 - t0).count();
+    return {reports.size() / secs, oms.stats().reports};
+}
+
+// Best of a few rounds, microseconds
+double cancel_all_us(size_t num_parents, size_t children_per_parent) {
+    double best = 1e30;
+    for (int round = 0; round < 5; ++round) {
+        KillSwitch kill;
+        OrderManager oms(num_parents, num_parents * children_per_parent, 1, kill);
+        for (size_t p = 0; p < num_parents; ++p) {
+            ParentOrder* parent = oms.new_parent(Side::Buy, static_cast<uint32_t>(children_per_parent * 100));
+            for (size_t c = 0; c < children_per_parent; ++c) {
+                ChildOrder* child = oms.send_child(parent->id, 100 + static_cast<int64_t>(c % 8), 100);
+                oms.apply({child->id, ReportType::Ack, 0, 0, 0});
+            }
+        }
+        std::vector<OutboundMessage> batch;
+        batch.reserve(num_parents * children_per_parent);
+
+        auto t0 = std::chrono::steady_clock::now();
+        kill.trigger();
+        oms.cancel_all(batch);
+        auto t1 = std::chrono::steady_clock::now();
+        if (batch.size() != num_parents * children_per_parent) {
+            std::printf("cancel_all missed children\n");
+        }
+        best = std::min(best, std::chrono::duration<double, std::micro>(t1 - t0).count());
+    }
+    return best;
+}
+
+} // namespace
+
+int main() {
+    std::printf("%-10s %-10s %12s %14s\n", "parents", "children", "reports", "Mreports/s");
+    for (size_t parents : {1'000, 10'000, 50'000}) {
+        for (size_t children : {4, 20}) {
+            RoundResult r = run_round(parents, children);
+            std::printf("%-10zu %-10zu %12llu %14.1f\n", parents, children,
+                        static_cast<unsigned long long>(r.reports), r.reports_per_sec / 1e6);
+        }
+    }
+
+    std::printf("\n%-10s %-10s %12s %14s\n", "parents", "children", "cancels", "cancel_all us");
+    for (size_t parents : {100, 1'000}) {
+        for (size_t children : {10, 100}) {
+            std::printf("%-10zu %-10zu %12zu %14.0f\n", parents, children, parents * children,
+                        cancel_all_us(parents, children));
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,105 @@
+// Shared message-rate throttle under contention: RateThrottle vs a mutex bucket
+//
+// N threads hammer one throttle for a fixed wall time, as strategy threads
+// slicing at once would. Reports attempted acquires per second across all
+// threads and how many were admitted against the configured budget
+// (rate * elapsed + burst).
+
+#include "rate_throttle.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace execution;
+
+namespace {
+
+// Classic refill-on-acquire bucket behind a mutex, for reference
+class MutexBucket {
+private:
+    std::mutex mutex_;
+    double tokens_;
+    double burst_;
+    double per_tick_;
+    uint64_t last_;
+
+public:
+    MutexBucket(double rate, uint32_t burst)
+        : tokens_(burst), burst_(burst), per_tick_(rate / TscClock::ticks_per_second()), last_(TscClock::now()) {}
+
+    bool try_acquire() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        uint64_t now = TscClock::now();
+        tokens_ = std::min(burst_, tokens_ + (now - last_) * per_tick_);
+        last_ = now;
+        if (tokens_ < 1.0) {
+            return false;
+        }
+        tokens_ -= 1.0;
+        return true;
+    }
+};
+
+struct Result {
+    double mops;
+    uint64_t admitted;
+    double budget;
+};
+
+template <typename Throttle>
+Result hammer(Throttle& throttle, size_t num_threads, double rate, uint32_t burst) {
+    const auto duration = std::chrono::milliseconds(200);
+    std::atomic<bool> go{false};
+    std::atomic<uint64_t> attempts{0};
+    std::atomic<uint64_t> admitted{0};
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&] {
+            while (!go.load(std::memory_order_acquire)) {
+            }
+            auto end = std::chrono::steady_clock::now() + duration;
+            uint64_t tries = 0;
+            uint64_t ok = 0;
+            do {
+                for (int i = 0; i < 256; ++i) {
+                    ok += throttle.try_acquire() ? 1 : 0;
+                }
+                tries += 256;
+            } while (std::chrono::steady_clock::now() < end);
+            attempts += tries;
+            admitted += ok;
+        });
+    }
+    auto t0 = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (std::thread& t : threads) {
+        t.join();
+    }
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    return {attempts / secs / 1e6, admitted.load(), rate * secs + burst};
+}
+
+} // namespace
+
+int main() {
+    const double rate = 100'000.0;
+    const uint32_t burst = 500;
+    std::printf("TSC: %.3f GHz, rate %.0f msg/s, burst %u\n", TscClock::ticks_per_second() / 1e9, rate, burst);
+    std::printf("%-8s %-10s %14s %12s %12s\n", "threads", "throttle", "Macquire/s", "admitted", "budget");
+    for (size_t threads : {1, 2, 4, 8, 16, 32}) {
+        RateThrottle gcra(rate, burst);
+        Result a = hammer(gcra, threads, rate, burst);
+        std::printf("%-8zu %-10s %14.1f %12llu %12.0f\n", threads, "gcra", a.mops,
+                    static_cast<unsigned long long>(a.admitted), a.budget);
+        MutexBucket bucket(rate, burst);
+        Result b = hammer(bucket, threads, rate, burst);
+        std::printf("%-8zu %-10s %14.1f %12llu %12.0f\n", threads, "mutex", b.mops,
+                    static_cast<unsigned long long>(b.admitted), b.budget);
+    }
+    return 0;
+}
@@ -1,10 +1,59 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>   // std::vector, std::string
+#include <pybind11/numpy.h> // zero-copy NumPy views
 #include "execution_engine.hpp"
+#include "quantile_sketch.hpp"
+#include "regime_analytics.hpp"
+#include "execution_cost.hpp"
+#include "dp_solver.hpp"
+#include "execution_env.hpp"
+#include "mlp_model.hpp"
+#include "mlp_policy.hpp"
+#include "market_data.hpp"
+#include "feature_matrix.hpp"
+#include "impact_calibration.hpp"
+#include "intraday_generator.hpp"
+#include "bar_aggregator.hpp"
+#include "order_book.hpp"
+#include "itch_parser.hpp"
+#include "queue_position.hpp"
+#include "limit_strategy.hpp"
+#include "oms.hpp"
+#include "rate_throttle.hpp"
+#include "symbol_table.hpp"
+#include "session_calendar.hpp"
+#include "slice_sweep.hpp"
+#include "lane_batch.hpp"
+#include "data_loader.hpp"
+
+#include <optional>
 
 namespace py = pybind11;
 using namespace execution;
 
+namespace {
+
+// Copyable view of a ChildOrder (its fill list is not copyable)
+struct ChildSnapshot {
+    uint64_t id;
+    uint64_t parent_id;
+    int64_t price;
+    uint32_t quantity;
+    uint32_t filled;
+    OrderState state;
+
+    uint32_t remaining() const { return quantity - filled; }
+};
+
+std::optional<ChildSnapshot> snapshot(const ChildOrder* child) {
+    if (!child) {
+        return std::nullopt;
+    }
+    return ChildSnapshot{child->id, child->parent_id, child->price, child->quantity, child->filled, child->state};
+}
+
+} // namespace
+
 PYBIND11_MODULE(_execution_cpp, m) {
     m.doc() = "C++ TWAP execution engine for low-latency trading";
     
@@ -94,4 +143,975 @@ PYBIND11_MODULE(_execution_cpp, m) {
         }
     );   
 
+    /**
+     * Expose QuantileSketch class
+     */
+    py::class_<QuantileSketch>(m, "QuantileSketch", "Mergeable KLL quantile sketch")
+        // Constructor
+        .def(py::init<size_t, uint64_t>(),
+             py::arg("k") = QuantileSketch::DEFAULT_K,
+             py::arg("seed") = 0x9E3779B97F4A7C15ULL,
+             "Create a sketch, larger k = smaller rank error\n"
+            )
+
+        // Feed values (NaN ignored)
+        .def("update", py::overload_cast<double>(&QuantileSketch::update),
+            py::arg("value"),
+            "Add one value\n"
+        )
+        .def("update_many", py::overload_cast<const std::vector<double>&>(&QuantileSketch::update),
+            py::arg("values"),
+            "Add a batch of values\n"
+        )
+        .def("merge", &QuantileSketch::merge,
+            py::arg("other"),
+            "Fold another sketch into this one\n"
+        )
+
+        // Queries
+        .def("quantile", &QuantileSketch::quantile, py::arg("q"), "Value at rank q in [0, 1]")
+        .def("quantiles", &QuantileSketch::quantiles, py::arg("qs"), "Values at several ranks")
+        .def("rank", &QuantileSketch::rank, py::arg("value"), "Fraction of values <= value")
+
+        // Attributes (READ only)
+        .def_property_readonly("count", &QuantileSketch::count, "Number of values seen")
+        .def_property_readonly("min", &QuantileSketch::min, "Exact minimum")
+        .def_property_readonly("max", &QuantileSketch::max, "Exact maximum")
+        .def_property_readonly("k", &QuantileSketch::k, "Accuracy parameter")
+        .def_property_readonly("num_retained", &QuantileSketch::num_retained, "Values kept in memory")
+
+        // __repr__ method for print()
+        .def("__repr__", [](const QuantileSketch& q) {
+            return "<QuantileSketch k=" + std::to_string(q.k()) +
+                   " count=" + std::to_string(q.count()) +
+                   " retained=" + std::to_string(q.num_retained()) + ">";
+        }
+    );
+
+
+    /**
+     * Expose regime-bucketed analytics
+     */
+    py::class_<RegimeConfig>(m, "RegimeConfig", "Regime labelling parameters")
+        .def(py::init<>(), "Default config: 20d vol, 20d/250d volume, 3x3 buckets")
+        .def_readwrite("vol_window", &RegimeConfig::vol_window, "Rolling volatility window (days)")
+        .def_readwrite("volume_window", &RegimeConfig::volume_window, "Short volume average (days)")
+        .def_readwrite("volume_baseline", &RegimeConfig::volume_baseline, "Long volume average (days)")
+        .def_readwrite("num_vol_buckets", &RegimeConfig::num_vol_buckets, "Volatility quantile buckets")
+        .def_readwrite("num_volume_buckets", &RegimeConfig::num_volume_buckets, "Volume quantile buckets")
+        .def_readwrite("num_threads", &RegimeConfig::num_threads, "Worker threads (0 = all cores)");
+
+    py::class_<RegimeBucket>(m, "RegimeBucket", "TWAP vs VWAP metrics for one regime cell")
+        .def_readonly("vol_bucket", &RegimeBucket::vol_bucket)
+        .def_readonly("volume_bucket", &RegimeBucket::volume_bucket)
+        .def_readonly("count", &RegimeBucket::count)
+        .def_readonly("twap_mean_bps", &RegimeBucket::twap_mean_bps)
+        .def_readonly("twap_std_bps", &RegimeBucket::twap_std_bps)
+        .def_readonly("twap_p5_bps", &RegimeBucket::twap_p5_bps)
+        .def_readonly("twap_p95_bps", &RegimeBucket::twap_p95_bps)
+        .def_readonly("vwap_mean_bps", &RegimeBucket::vwap_mean_bps)
+        .def_readonly("vwap_std_bps", &RegimeBucket::vwap_std_bps)
+        .def_readonly("vwap_p5_bps", &RegimeBucket::vwap_p5_bps)
+        .def_readonly("vwap_p95_bps", &RegimeBucket::vwap_p95_bps)
+
+        // __repr__ method for print()
+        .def("__repr__", [](const RegimeBucket& b) {
+            return "<RegimeBucket vol=" + std::to_string(b.vol_bucket) +
+                   " volume=" + std::to_string(b.volume_bucket) +
+                   " n=" + std::to_string(b.count) +
+                   " twap=" + std::to_string(b.twap_mean_bps) +
+                   "bps vwap=" + std::to_string(b.vwap_mean_bps) + "bps>";
+        }
+    );
+
+    py::class_<RegimeReport>(m, "RegimeReport", "Per-bucket strategy metrics")
+        .def_readonly("buckets", &RegimeReport::buckets, "Row-major (vol, volume) buckets")
+        .def_readonly("vol_edges", &RegimeReport::vol_edges, "Volatility quantile cut points")
+        .def_readonly("volume_edges", &RegimeReport::volume_edges, "Relative volume cut points")
+        .def_readonly("vol_labels", &RegimeReport::vol_labels, "Vol bucket per start index (-1 = none)")
+        .def_readonly("volume_labels", &RegimeReport::volume_labels, "Volume bucket per start index (-1 = none)")
+        .def_readonly("num_skipped", &RegimeReport::num_skipped, "Start indices without a label");
+
+    m.def("regime_backtest", &regime_backtest,
+        py::arg("prices"),
+        py::arg("volumes"),
+        py::arg("order"),
+        py::arg("config") = RegimeConfig(),
+        py::call_guard<py::gil_scoped_release>(),
+        "TWAP vs VWAP slippage per volatility/volume regime, one parallel pass\n"
+    );
+
+
+    /**
+     * Expose execution cost gradients (forward-mode AD)
+     */
+    py::class_<CostModel>(m, "CostModel", "Evaluation settings for the cost objective")
+        .def(py::init<>())
+        .def_readwrite("sigma_bps", &CostModel::sigma_bps, "Price volatility per slice (bps)")
+        .def_readwrite("variance_penalty", &CostModel::variance_penalty, "Weight of holding risk (1/bps)");
+
+    py::class_<CostGradient>(m, "CostGradient", "Mean objective over history and its gradient")
+        .def_readonly("objective_bps", &CostGradient::objective_bps)
+        .def_readonly("cost_bps", &CostGradient::cost_bps)
+        .def_readonly("risk_bps", &CostGradient::risk_bps)
+        .def_readonly("d_eta", &CostGradient::d_eta, "d objective / d eta")
+        .def_readonly("d_risk_aversion", &CostGradient::d_risk_aversion, "d objective / d risk_aversion")
+        .def_readonly("count", &CostGradient::count, "Windows evaluated");
+
+    py::class_<TuningResult>(m, "TuningResult", "Outcome of risk aversion tuning")
+        .def_readonly("risk_aversion", &TuningResult::risk_aversion)
+        .def_readonly("objective_bps", &TuningResult::objective_bps)
+        .def_readonly("d_eta", &TuningResult::d_eta)
+        .def_readonly("iterations", &TuningResult::iterations);
+
+    m.def("history_cost_gradient", &history_cost_gradient,
+        py::arg("prices"),
+        py::arg("volumes"),
+        py::arg("order"),
+        py::arg("eta"),
+        py::arg("risk_aversion"),
+        py::arg("model") = CostModel(),
+        py::arg("num_threads") = 0,
+        py::call_guard<py::gil_scoped_release>(),
+        "Mean cost objective and exact gradient w.r.t. (eta, risk_aversion)\n"
+    );
+
+    m.def("tune_risk_aversion", &tune_risk_aversion,
+        py::arg("prices"),
+        py::arg("volumes"),
+        py::arg("order"),
+        py::arg("eta"),
+        py::arg("initial_risk_aversion"),
+        py::arg("model") = CostModel(),
+        py::arg("max_iterations") = 50,
+        py::arg("num_threads") = 0,
+        py::call_guard<py::gil_scoped_release>(),
+        "Gradient descent on risk aversion over the whole history\n"
+    );
+
+
+    /**
+     * Expose dynamic-programming optimal execution solver
+     */
+    py::class_<DPCostModel>(m, "DPCostModel", "Impact / risk model for the DP solver")
+        .def(py::init<>())
+        .def_readwrite("eta", &DPCostModel::eta, "Impact coefficient")
+        .def_readwrite("beta", &DPCostModel::beta, "Impact exponent (0.5 = square root)")
+        .def_readwrite("fixed_cost", &DPCostModel::fixed_cost, "Cost per non-zero trade")
+        .def_readwrite("risk_aversion", &DPCostModel::risk_aversion, "Penalty on carried inventory")
+        .def_readwrite("sigma", &DPCostModel::sigma, "Price volatility per step");
+
+    py::class_<DPConfig>(m, "DPConfig", "Time x inventory grid for the DP solver")
+        .def(py::init<>())
+        .def_readwrite("num_steps", &DPConfig::num_steps, "Time steps")
+        .def_readwrite("num_lots", &DPConfig::num_lots, "Inventory grid size in lots")
+        .def_readwrite("lot_size", &DPConfig::lot_size, "Shares per lot")
+        .def_readwrite("volume_profile", &DPConfig::volume_profile, "Expected volume per step")
+        .def_readwrite("num_threads", &DPConfig::num_threads, "Threads for the non-convex path");
+
+    py::class_<DPSchedule>(m, "DPSchedule", "Optimal schedule")
+        .def_readonly("trades", &DPSchedule::trades, "Shares per step")
+        .def_readonly("expected_cost", &DPSchedule::expected_cost, "Optimal expected cost")
+        .def_readonly("used_convex_path", &DPSchedule::used_convex_path, "True if solved by slope merge");
+
+    m.def("solve_optimal_schedule", &solve_optimal_schedule,
+        py::arg("config"),
+        py::arg("model"),
+        py::call_guard<py::gil_scoped_release>(),
+        "Optimal execution schedule by backward induction over (time, inventory)\n"
+    );
+
+
+    /**
+     * Expose vectorized RL environment
+     * Returned arrays are views on the env buffers: overwritten by the next step
+     */
+    py::class_<EnvConfig>(m, "EnvConfig", "Vectorized environment settings")
+        .def(py::init<>())
+        .def_readwrite("num_envs", &EnvConfig::num_envs, "Parallel episodes")
+        .def_readwrite("horizon", &EnvConfig::horizon, "Decisions per episode")
+        .def_readwrite("order_size", &EnvConfig::order_size, "Shares per episode")
+        .def_readwrite("eta", &EnvConfig::eta, "Impact, bps per 100% participation")
+        .def_readwrite("seed", &EnvConfig::seed, "RNG seed for start indices")
+        .def_readwrite("num_threads", &EnvConfig::num_threads, "Threads per step");
+
+    auto obs_view = [](py::object self) {
+        auto& env = self.cast<ExecutionEnv&>();
+        return py::array_t<float>(
+            {env.num_envs(), ExecutionEnv::OBS_DIM},
+            {ExecutionEnv::OBS_DIM * sizeof(float), sizeof(float)},
+            env.observations(), self);
+    };
+    auto env_outputs = [obs_view](py::object self) {
+        auto& env = self.cast<ExecutionEnv&>();
+        py::array_t<float> rewards({env.num_envs()}, {sizeof(float)}, env.rewards(), self);
+        py::array_t<bool> dones({env.num_envs()}, {sizeof(uint8_t)}, reinterpret_cast<const bool*>(env.dones()), self);
+        return py::make_tuple(obs_view(self), rewards, dones);
+    };
+
+    py::class_<ExecutionEnv>(m, "ExecutionEnv", "N parallel execution episodes in SoA buffers")
+        // Constructor
+        .def(py::init<const std::vector<double>&, const std::vector<double>&, const EnvConfig&>(),
+             py::arg("prices"),
+             py::arg("volumes"),
+             py::arg("config") = EnvConfig(),
+             "Create environment over price / volume history\n"
+            )
+
+        // reset() -> obs (N, OBS_DIM)
+        .def("reset", [obs_view](py::object self) {
+            auto& env = self.cast<ExecutionEnv&>();
+            {
+                py::gil_scoped_release release;
+                env.reset();
+            }
+            return obs_view(self);
+        }, "Restart every episode, returns observations")
+
+        // step(actions) -> (obs, rewards, dones), finished episodes auto-reset
+        .def("step", [env_outputs](py::object self, py::array_t<float, py::array::c_style | py::array::forcecast> actions) {
+            auto& env = self.cast<ExecutionEnv&>();
+            if (static_cast<size_t>(actions.size()) != env.num_envs()) {
+                throw std::invalid_argument("need one action per environment");
+            }
+            {
+                py::gil_scoped_release release;
+                env.step(actions.data());
+            }
+            return env_outputs(self);
+        }, py::arg("actions"), "Trade a fraction of remaining shares in every episode")
+
+        .def_property_readonly("last_episode_costs", [](py::object self) {
+            auto& env = self.cast<ExecutionEnv&>();
+            return py::array_t<float>({env.num_envs()}, {sizeof(float)}, env.last_episode_costs(), self);
+        }, "Cost (bps) of the episode that just finished, per env")
+        .def_property_readonly("num_envs", &ExecutionEnv::num_envs)
+        .def_property_readonly_static("obs_dim", [](py::object) { return ExecutionEnv::OBS_DIM; })
+
+        // __repr__ method for print()
+        .def("__repr__", [](const ExecutionEnv& e) {
+            return "<ExecutionEnv envs=" + std::to_string(e.num_envs()) +
+                   " horizon=" + std::to_string(e.config().horizon) + ">";
+        }
+    );
+
+
+    /**
+     * Expose embedded MLP inference and learned slice policy
+     */
+    py::class_<MLPModel>(m, "MLPModel", "Small dense network evaluated in C++")
+        .def_static("load", &MLPModel::load, py::arg("path"), "Load weights from a text file")
+        .def("predict", [](const MLPModel& model, std::vector<float> x) {
+            if (x.size() != model.input_dim()) {
+                throw std::invalid_argument("wrong number of features");
+            }
+            std::vector<float> out(model.output_dim());
+            model.predict(x.data(), out.data());
+            return out;
+        }, py::arg("x"), "Evaluate one feature vector")
+        .def("predict_batch", [](const MLPModel& model, py::array_t<float, py::array::c_style | py::array::forcecast> x) {
+            if (x.ndim() != 2 || static_cast<size_t>(x.shape(1)) != model.input_dim()) {
+                throw std::invalid_argument("expected (n, input_dim) array");
+            }
+            size_t n = x.shape(0);
+            py::array_t<float> out({n, model.output_dim()});
+            {
+                py::gil_scoped_release release;
+                model.predict_batch(x.data(), n, out.mutable_data());
+            }
+            return out;
+        }, py::arg("x"), "Evaluate a batch of rows")
+        .def_property_readonly("input_dim", &MLPModel::input_dim)
+        .def_property_readonly("output_dim", &MLPModel::output_dim)
+
+        // __repr__ method for print()
+        .def("__repr__", [](const MLPModel& model) {
+            return "<MLPModel layers=" + std::to_string(model.num_layers()) +
+                   " in=" + std::to_string(model.input_dim()) +
+                   " out=" + std::to_string(model.output_dim()) + ">";
+        }
+    );
+
+    m.def("execute_mlp_policy", &execute_mlp_policy,
+        py::arg("prices"),
+        py::arg("volumes"),
+        py::arg("order"),
+        py::arg("start_idx"),
+        py::arg("model"),
+        "Execute one order with model-sized slices\n"
+    );
+
+    m.def("mlp_policy_slippage", &mlp_policy_slippage,
+        py::arg("prices"),
+        py::arg("volumes"),
+        py::arg("order"),
+        py::arg("model"),
+        py::arg("num_threads") = 0,
+        py::call_guard<py::gil_scoped_release>(),
+        "Slippage (bps) of the learned policy for every start index\n"
+    );
+
+
+    /**
+     * Expose columnar market data
+     */
+    py::class_<MarketData>(m, "MarketData", "Columnar OHLCV bars")
+        .def(py::init<>())
+        .def_readwrite("timestamps", &MarketData::timestamps, "yyyymmdd (daily) or ns (intraday)")
+        .def_readwrite("open", &MarketData::open)
+        .def_readwrite("high", &MarketData::high)
+        .def_readwrite("low", &MarketData::low)
+        .def_readwrite("close", &MarketData::close)
+        .def_readwrite("volume", &MarketData::volume)
+        .def("__len__", &MarketData::size)
+
+        // __repr__ method for print()
+        .def("__repr__", [](const MarketData& md) {
+            return "<MarketData bars=" + std::to_string(md.size()) + ">";
+        }
+    );
+
+    /**
+     * Expose feature matrix builder (result handed to NumPy without a copy)
+     */
+    py::enum_<FeatureKind>(m, "FeatureKind")
+        .value("Return", FeatureKind::Return)
+        .value("LogReturn", FeatureKind::LogReturn)
+        .value("RollingVol", FeatureKind::RollingVol)
+        .value("VolumeRatio", FeatureKind::VolumeRatio)
+        .value("Range", FeatureKind::Range)
+        .value("Gap", FeatureKind::Gap)
+        .value("ParkinsonVol", FeatureKind::ParkinsonVol);
+
+    py::enum_<MatrixLayout>(m, "MatrixLayout")
+        .value("RowMajor", MatrixLayout::RowMajor)
+        .value("ColumnMajor", MatrixLayout::ColumnMajor);
+
+    py::class_<FeatureMatrixBuilder>(m, "FeatureMatrixBuilder", "Parallel, cache-blocked feature pipeline")
+        .def(py::init<>())
+        .def("add", &FeatureMatrixBuilder::add,
+            py::arg("kind"),
+            py::arg("window") = 1,
+            py::return_value_policy::reference_internal,
+            "Append a feature column (chainable)\n"
+        )
+        .def("names", &FeatureMatrixBuilder::names, "Column names")
+        .def("build", [](const FeatureMatrixBuilder& builder, const std::vector<MarketData>& symbols, MatrixLayout layout, size_t num_threads) {
+            FeatureMatrix* matrix = nullptr;
+            {
+                py::gil_scoped_release release;
+                matrix = new FeatureMatrix(builder.build(symbols, layout, num_threads));
+            }
+            // NumPy array borrows the buffer, capsule frees it with the array
+            py::capsule owner(matrix, [](void* p) { delete reinterpret_cast<FeatureMatrix*>(p); });
+            std::vector<size_t> strides = layout == MatrixLayout::RowMajor
+                ? std::vector<size_t>{matrix->cols * sizeof(double), sizeof(double)}
+                : std::vector<size_t>{sizeof(double), matrix->rows * sizeof(double)};
+            return py::array_t<double>({matrix->rows, matrix->cols}, strides, matrix->data.data(), owner);
+        },
+            py::arg("symbols"),
+            py::arg("layout") = MatrixLayout::RowMajor,
+            py::arg("num_threads") = 0,
+            "Features for every (symbol, date), rows stacked symbol by symbol\n"
+        );
+
+
+    /**
+     * Expose market impact calibration
+     */
+    py::enum_<ImpactModelKind>(m, "ImpactModelKind")
+        .value("Linear", ImpactModelKind::Linear)
+        .value("SquareRoot", ImpactModelKind::SquareRoot)
+        .value("PowerLaw", ImpactModelKind::PowerLaw);
+
+    py::class_<FillRecords>(m, "FillRecords", "Fill records as columns")
+        .def(py::init<>())
+        .def_readwrite("size", &FillRecords::size, "Shares filled")
+        .def_readwrite("adv", &FillRecords::adv, "Average daily volume")
+        .def_readwrite("volatility", &FillRecords::volatility, "Daily volatility (fraction)")
+        .def_readwrite("cost_bps", &FillRecords::cost_bps, "Realized cost vs arrival (bps)")
+        .def("__len__", &FillRecords::count);
+
+    py::class_<ImpactFit>(m, "ImpactFit", "Calibrated impact model")
+        .def_readonly("kind", &ImpactFit::kind)
+        .def_readonly("coefficient", &ImpactFit::coefficient)
+        .def_readonly("exponent", &ImpactFit::exponent)
+        .def_readonly("intercept_bps", &ImpactFit::intercept_bps)
+        .def_readonly("r_squared", &ImpactFit::r_squared)
+        .def_readonly("num_fills", &ImpactFit::num_fills)
+        .def("predict_bps", [](const ImpactFit& fit, double size, double adv, double volatility) {
+            return predict_impact_bps(fit, size, adv, volatility);
+        }, py::arg("size"), py::arg("adv"), py::arg("volatility"), "Predicted cost for one order")
+
+        // __repr__ method for print()
+        .def("__repr__", [](const ImpactFit& f) {
+            return "<ImpactFit coef=" + std::to_string(f.coefficient) +
+                   " exp=" + std::to_string(f.exponent) +
+                   " intercept=" + std::to_string(f.intercept_bps) +
+                   "bps r2=" + std::to_string(f.r_squared) + ">";
+        }
+    );
+
+    m.def("calibrate_impact", &calibrate_impact,
+        py::arg("fills"),
+        py::arg("kind"),
+        py::arg("fit_intercept") = true,
+        py::arg("num_threads") = 0,
+        py::call_guard<py::gil_scoped_release>(),
+        "Least-squares impact fit from fill records\n"
+    );
+
+
+    /**
+     * Expose synthetic intraday bar generator
+     */
+    py::class_<IntradayConfig>(m, "IntradayConfig", "Synthetic minute-bar settings")
+        .def(py::init<>())
+        .def_readwrite("minutes_per_day", &IntradayConfig::minutes_per_day)
+        .def_readwrite("volume_u_depth", &IntradayConfig::volume_u_depth, "Open/close volume vs midday")
+        .def_readwrite("seed", &IntradayConfig::seed)
+        .def_readwrite("num_threads", &IntradayConfig::num_threads, "0 = hardware concurrency");
+
+    m.def("generate_intraday_day", [](const MarketData& daily, size_t day, const IntradayConfig& config) {
+            if (day >= daily.size()) {
+                throw py::index_error("day out of range");
+            }
+            MarketData bars;
+            IntradayBarGenerator(daily, config).generate_day(day, bars);
+            return bars;
+        },
+        py::arg("daily"),
+        py::arg("day"),
+        py::arg("config") = IntradayConfig(),
+        "Brownian-bridge minute bars for one daily bar\n"
+    );
+
+    m.def("intraday_twap_slippage", &intraday_twap_slippage,
+        py::arg("daily"),
+        py::arg("slices_per_day"),
+        py::arg("config") = IntradayConfig(),
+        py::call_guard<py::gil_scoped_release>(),
+        "Per-day TWAP slippage (bps vs open) replayed on generated minute bars\n"
+    );
+
+
+    /**
+     * Expose tick-to-bar aggregation
+     */
+    py::enum_<BarKind>(m, "BarKind")
+        .value("Time", BarKind::Time)
+        .value("Volume", BarKind::Volume)
+        .value("Dollar", BarKind::Dollar);
+
+    py::class_<BarSpec>(m, "BarSpec", "Bar type and size")
+        .def(py::init([](BarKind kind, double threshold) {
+            return BarSpec{kind, threshold};
+        }), py::arg("kind"), py::arg("threshold"))
+        .def_readwrite("kind", &BarSpec::kind)
+        .def_readwrite("threshold", &BarSpec::threshold, "ns (time), shares (volume) or notional (dollar)");
+
+    py::class_<TickData>(m, "TickData", "Columnar trade ticks")
+        .def(py::init<>())
+        .def_readwrite("timestamps", &TickData::timestamps, "ns")
+        .def_readwrite("price", &TickData::price)
+        .def_readwrite("size", &TickData::size)
+        .def("__len__", &TickData::count);
+
+    m.def("aggregate_bars", &aggregate_bars,
+        py::arg("ticks"),
+        py::arg("specs"),
+        py::call_guard<py::gil_scoped_release>(),
+        "Time / volume / dollar bars from ticks in one pass, one MarketData per spec\n"
+    );
+
+
+    /**
+     * Expose order book and ITCH replay
+     */
+    py::enum_<Side>(m, "Side")
+        .value("Buy", Side::Buy)
+        .value("Sell", Side::Sell);
+
+    py::class_<PriceLevel>(m, "PriceLevel", "Aggregated price level")
+        .def_readonly("quantity", &PriceLevel::quantity)
+        .def_readonly("num_orders", &PriceLevel::num_orders);
+
+    py::class_<OrderBook>(m, "OrderBook", "Order-by-order limit book (integer price ticks)")
+        .def(py::init<>())
+        .def("add", &OrderBook::add, py::arg("id"), py::arg("side"), py::arg("price"), py::arg("quantity"))
+        .def("execute", &OrderBook::execute, py::arg("id"), py::arg("quantity"))
+        .def("cancel", &OrderBook::cancel, py::arg("id"), py::arg("quantity"))
+        .def("remove", &OrderBook::remove, py::arg("id"))
+        .def("replace", &OrderBook::replace, py::arg("old_id"), py::arg("new_id"), py::arg("price"), py::arg("quantity"))
+        .def("level", &OrderBook::level, py::arg("side"), py::arg("price"))
+        .def_property_readonly("best_bid", &OrderBook::best_bid, "0 when empty")
+        .def_property_readonly("best_ask", &OrderBook::best_ask, "0 when empty")
+        .def("__len__", &OrderBook::num_orders);
+
+    py::class_<ItchStats>(m, "ItchStats", "Parse counters")
+        .def_readonly("messages", &ItchStats::messages)
+        .def_readonly("adds", &ItchStats::adds)
+        .def_readonly("executes", &ItchStats::executes)
+        .def_readonly("cancels", &ItchStats::cancels)
+        .def_readonly("deletes", &ItchStats::deletes)
+        .def_readonly("replaces", &ItchStats::replaces)
+        .def_readonly("skipped", &ItchStats::skipped)
+        .def_readonly("bytes", &ItchStats::bytes)
+        .def_readonly("truncated", &ItchStats::truncated);
+
+    py::class_<ItchWriter>(m, "ItchWriter", "Encoder for ITCH sample files")
+        .def(py::init<>())
+        .def("add", &ItchWriter::add, py::arg("locate"), py::arg("timestamp"), py::arg("order_ref"),
+             py::arg("side"), py::arg("shares"), py::arg("price"), py::arg("stock") = "")
+        .def("execute", &ItchWriter::execute, py::arg("locate"), py::arg("timestamp"), py::arg("order_ref"),
+             py::arg("shares"), py::arg("match_number"))
+        .def("cancel", &ItchWriter::cancel, py::arg("locate"), py::arg("timestamp"), py::arg("order_ref"), py::arg("shares"))
+        .def("remove", &ItchWriter::remove, py::arg("locate"), py::arg("timestamp"), py::arg("order_ref"))
+        .def("replace", &ItchWriter::replace, py::arg("locate"), py::arg("timestamp"), py::arg("original_ref"),
+             py::arg("new_ref"), py::arg("shares"), py::arg("price"))
+        .def("save", &ItchWriter::save, py::arg("path"));
+
+    py::class_<ItchBookReplay>(m, "ItchBookReplay", "One order book per ITCH stock locate")
+        .def(py::init<>())
+        .def("parse_file", [](ItchBookReplay& replay, const std::string& path) {
+            return parse_itch_file(path, replay);
+        }, py::arg("path"), py::call_guard<py::gil_scoped_release>(), "mmap and replay a length-prefixed ITCH file")
+        .def("book", &ItchBookReplay::book, py::arg("locate"), py::return_value_policy::reference_internal)
+        .def_property_readonly("num_books", &ItchBookReplay::num_books)
+        .def_property_readonly("unknown_refs", &ItchBookReplay::unknown_refs);
+
+
+    /**
+     * Expose queue-position model for passive orders
+     */
+    py::enum_<CancelModel>(m, "CancelModel")
+        .value("Behind", CancelModel::Behind)
+        .value("Ahead", CancelModel::Ahead)
+        .value("Proportional", CancelModel::Proportional);
+
+    py::class_<PassiveOrder>(m, "PassiveOrder", "Own resting order")
+        .def_readonly("id", &PassiveOrder::id)
+        .def_readonly("side", &PassiveOrder::side)
+        .def_readonly("price", &PassiveOrder::price)
+        .def_readonly("quantity", &PassiveOrder::quantity)
+        .def_readonly("filled", &PassiveOrder::filled)
+        .def_readonly("ahead", &PassiveOrder::ahead, "Estimated shares queued in front")
+        .def_readonly("active", &PassiveOrder::active);
+
+    py::class_<QueueFill>(m, "QueueFill", "Simulated passive fill")
+        .def_readonly("id", &QueueFill::id)
+        .def_readonly("timestamp", &QueueFill::timestamp)
+        .def_readonly("price", &QueueFill::price)
+        .def_readonly("quantity", &QueueFill::quantity);
+
+    py::class_<QueueTracker>(m, "QueueTracker", "Queue-position fills for own passive orders on an ITCH replay")
+        .def(py::init<uint16_t, CancelModel>(), py::arg("locate") = 0, py::arg("model") = CancelModel::Proportional)
+        .def("post", &QueueTracker::post, py::arg("side"), py::arg("price"), py::arg("quantity"))
+        .def("cancel", &QueueTracker::cancel, py::arg("id"))
+        .def("parse_file", [](QueueTracker& tracker, const std::string& path) {
+            return parse_itch_file(path, tracker);
+        }, py::arg("path"), py::call_guard<py::gil_scoped_release>(), "Replay (more of) an ITCH file")
+        .def("order", &QueueTracker::order, py::arg("id"), py::return_value_policy::copy,
+             "Snapshot of an own order (re-query after further replay or posts)")
+        .def_property_readonly("fills", &QueueTracker::fills)
+        .def("book", &QueueTracker::book, py::return_value_policy::reference_internal);
+
+
+    /**
+     * Expose passive/aggressive limit placement
+     */
+    py::class_<BookTape>(m, "BookTape", "Book changes of one ITCH locate, with touch snapshots")
+        .def(py::init<uint16_t>(), py::arg("locate") = 0)
+        .def("parse_file", [](BookTape& tape, const std::string& path) {
+            return parse_itch_file(path, tape);
+        }, py::arg("path"), py::call_guard<py::gil_scoped_release>(), "Record (more of) an ITCH file")
+        .def("__len__", [](const BookTape& tape) { return tape.events().size(); })
+        .def("book", &BookTape::book, py::return_value_policy::reference_internal);
+
+    py::class_<PlacementConfig>(m, "PlacementConfig", "Parent order and slicing for the placement sweep")
+        .def(py::init<>())
+        .def_readwrite("side", &PlacementConfig::side)
+        .def_readwrite("quantity", &PlacementConfig::quantity)
+        .def_readwrite("start_time", &PlacementConfig::start_time, "ns, tape clock")
+        .def_readwrite("end_time", &PlacementConfig::end_time)
+        .def_readwrite("num_slices", &PlacementConfig::num_slices)
+        .def_readwrite("cancel_model", &PlacementConfig::cancel_model)
+        .def_readwrite("num_threads", &PlacementConfig::num_threads, "0 = hardware concurrency");
+
+    py::class_<PlacementParams>(m, "PlacementParams", "One passive/aggressive parameterization")
+        .def(py::init([](double escalate_at, double max_queue_ratio) {
+            return PlacementParams{escalate_at, max_queue_ratio};
+        }), py::arg("escalate_at") = 0.8, py::arg("max_queue_ratio") = 0.0)
+        .def_readwrite("escalate_at", &PlacementParams::escalate_at, "Slice fraction after which the rest crosses")
+        .def_readwrite("max_queue_ratio", &PlacementParams::max_queue_ratio, "Escalate if queue ahead > ratio * remaining");
+
+    py::class_<PlacementResult>(m, "PlacementResult", "Outcome of one parameterization")
+        .def_readonly("filled", &PlacementResult::filled)
+        .def_readonly("passive_filled", &PlacementResult::passive_filled)
+        .def_readonly("unfilled", &PlacementResult::unfilled, "Shares left at a deadline with no far touch")
+        .def_readonly("avg_price", &PlacementResult::avg_price)
+        .def_readonly("slippage_bps", &PlacementResult::slippage_bps)
+        .def_readonly("spread_capture_bps", &PlacementResult::spread_capture_bps);
+
+    m.def("sweep_limit_strategy", [](const BookTape& tape, const PlacementConfig& config, const std::vector<PlacementParams>& params) {
+            return sweep_limit_strategy(tape.events(), config, params);
+        },
+        py::arg("tape"),
+        py::arg("config"),
+        py::arg("params"),
+        py::call_guard<py::gil_scoped_release>(),
+        "Evaluate many passive/aggressive parameterizations in one pass over the tape\n"
+    );
+
+
+    /**
+     * Expose order management system
+     */
+    py::enum_<OrderState>(m, "OrderState")
+        .value("New", OrderState::New)
+        .value("Acked", OrderState::Acked)
+        .value("PartiallyFilled", OrderState::PartiallyFilled)
+        .value("Filled", OrderState::Filled)
+        .value("Cancelled", OrderState::Cancelled)
+        .value("Rejected", OrderState::Rejected);
+
+    py::enum_<ReportType>(m, "ReportType")
+        .value("Ack", ReportType::Ack)
+        .value("Fill", ReportType::Fill)
+        .value("Cancel", ReportType::Cancel)
+        .value("Reject", ReportType::Reject);
+
+    py::class_<ExecutionReport>(m, "ExecutionReport", "Venue report for one child order")
+        .def(py::init([](uint64_t child_id, ReportType type, uint32_t quantity, int64_t price, uint64_t timestamp) {
+            return ExecutionReport{child_id, type, quantity, price, timestamp};
+        }), py::arg("child_id"), py::arg("type"), py::arg("quantity") = 0, py::arg("price") = 0, py::arg("timestamp") = 0)
+        .def_readwrite("child_id", &ExecutionReport::child_id)
+        .def_readwrite("type", &ExecutionReport::type)
+        .def_readwrite("quantity", &ExecutionReport::quantity)
+        .def_readwrite("price", &ExecutionReport::price)
+        .def_readwrite("timestamp", &ExecutionReport::timestamp);
+
+    py::class_<ParentOrder>(m, "ParentOrder", "Parent order tracked by the OMS")
+        .def_readonly("id", &ParentOrder::id)
+        .def_readonly("side", &ParentOrder::side)
+        .def_readonly("quantity", &ParentOrder::quantity)
+        .def_readonly("filled", &ParentOrder::filled)
+        .def_readonly("open", &ParentOrder::open, "Sent, not yet filled or dead")
+        .def_readonly("state", &ParentOrder::state)
+        .def_property_readonly("remaining", &ParentOrder::remaining)
+        .def_property_readonly("unallocated", &ParentOrder::unallocated, "Quantity a strategy may still send")
+        .def_property_readonly("avg_price", &ParentOrder::avg_price);
+
+    py::class_<ChildSnapshot>(m, "ChildOrder", "Child order sent for a parent")
+        .def_readonly("id", &ChildSnapshot::id)
+        .def_readonly("parent_id", &ChildSnapshot::parent_id)
+        .def_readonly("price", &ChildSnapshot::price)
+        .def_readonly("quantity", &ChildSnapshot::quantity)
+        .def_readonly("filled", &ChildSnapshot::filled)
+        .def_readonly("state", &ChildSnapshot::state)
+        .def_property_readonly("remaining", &ChildSnapshot::remaining);
+
+    py::class_<KillSwitch>(m, "KillSwitch", "Engine-wide stop for child order generation")
+        .def_static("global_switch", &KillSwitch::global, py::return_value_policy::reference)
+        .def_property_readonly("engaged", &KillSwitch::engaged)
+        .def("trigger", &KillSwitch::trigger)
+        .def("reset", &KillSwitch::reset);
+
+    // Records live in pool slots that release_parent recycles, so Python gets
+    // snapshots and re-queries by id
+    py::class_<OrderManager>(m, "OrderManager", "Parents, children and execution reports on pooled records")
+        .def(py::init<size_t, size_t, size_t>(), py::arg("max_parents"), py::arg("max_children"), py::arg("max_fills"))
+        .def("new_parent", py::overload_cast<const Order&>(&OrderManager::new_parent), py::arg("order"),
+             py::return_value_policy::copy)
+        .def("new_parent", py::overload_cast<Side, uint32_t>(&OrderManager::new_parent), py::arg("side"), py::arg("quantity"),
+             py::return_value_policy::copy)
+        .def("send_child", [](OrderManager& oms, uint64_t parent_id, int64_t price, uint32_t quantity) {
+            return snapshot(oms.send_child(parent_id, price, quantity));
+        }, py::arg("parent_id"), py::arg("price"), py::arg("quantity"))
+        .def("apply", &OrderManager::apply, py::arg("report"))
+        .def("cancel_parent", &OrderManager::cancel_parent, py::arg("parent_id"))
+        .def("release_parent", &OrderManager::release_parent, py::arg("parent_id"))
+        .def("find_parent", &OrderManager::find_parent, py::arg("parent_id"), py::return_value_policy::copy,
+             "Snapshot of a parent, None once released")
+        .def("find_child", [](OrderManager& oms, uint64_t child_id) { return snapshot(oms.find_child(child_id)); },
+             py::arg("child_id"), "Snapshot of a child, None once its parent is released")
+        .def("remaining", &OrderManager::remaining, py::arg("parent_id"))
+        .def("cancel_all", [](OrderManager& oms) {
+            std::vector<OutboundMessage> batch;
+            oms.cancel_all(batch);
+            return batch;
+        }, "Cancel-request every live parent; one Cancel message per live child")
+        .def_property_readonly("num_parents", &OrderManager::num_parents)
+        .def_property_readonly("num_children", &OrderManager::num_children);
+
+
+    /**
+     * Expose lock-free message rate throttle
+     */
+    py::class_<RateThrottle>(m, "RateThrottle", "Lock-free token bucket (GCRA) shared by sending threads")
+        .def(py::init([](double rate, uint32_t burst) { return std::make_unique<RateThrottle>(rate, burst); }),
+             py::arg("rate"), py::arg("burst"), "rate messages per second, bursts of up to burst")
+        .def("try_acquire", &RateThrottle::try_acquire, py::arg("n") = 1)
+        .def("available", [](const RateThrottle& t) { return t.available_at(TscClock::now()); });
+
+    py::enum_<OutboundKind>(m, "OutboundKind")
+        .value("New", OutboundKind::New)
+        .value("Amend", OutboundKind::Amend)
+        .value("Cancel", OutboundKind::Cancel);
+
+    py::class_<OutboundMessage>(m, "OutboundMessage", "Outbound child-order message")
+        .def(py::init([](uint64_t child_id, OutboundKind kind, int64_t price, uint32_t quantity) {
+            return OutboundMessage{child_id, kind, price, quantity};
+        }), py::arg("child_id"), py::arg("kind"), py::arg("price") = 0, py::arg("quantity") = 0)
+        .def_readonly("child_id", &OutboundMessage::child_id)
+        .def_readonly("kind", &OutboundMessage::kind)
+        .def_readonly("price", &OutboundMessage::price)
+        .def_readonly("quantity", &OutboundMessage::quantity);
+
+    py::class_<CoalescingQueue>(m, "CoalescingQueue", "Throttled messages, coalesced per child")
+        .def(py::init<>())
+        .def("push", &CoalescingQueue::push, py::arg("message"))
+        .def("submit", [](CoalescingQueue& q, RateThrottle& throttle, const OutboundMessage& message, const py::function& send) {
+            return q.submit(throttle, message, [&](const OutboundMessage& msg) { send(msg); });
+        }, py::arg("throttle"), py::arg("message"), py::arg("send"))
+        .def("drain", [](CoalescingQueue& q, RateThrottle& throttle, const py::function& send) {
+            return q.drain(throttle, [&](const OutboundMessage& msg) { send(msg); });
+        }, py::arg("throttle"), py::arg("send"), "Send queued messages while tokens last")
+        .def("__len__", &CoalescingQueue::size);
+
+
+    /**
+     * Expose interned symbol table
+     */
+    py::class_<SymbolTable>(m, "SymbolTable", "Ticker -> dense id, minimal perfect hash after build()")
+        .def(py::init<>())
+        .def(py::init<const std::vector<std::string>&>(), py::arg("tickers"))
+        .def("intern", &SymbolTable::intern, py::arg("symbol"))
+        .def("build", &SymbolTable::build)
+        .def("find", [](const SymbolTable& table, const std::string& symbol) -> py::object {
+            uint32_t id = table.find(symbol);
+            return id == SymbolTable::NOT_FOUND ? py::object(py::none()) : py::object(py::int_(id));
+        }, py::arg("symbol"), "Id of symbol, None if unknown")
+        .def("name", &SymbolTable::name, py::arg("id"))
+        .def_property_readonly("names", &SymbolTable::names)
+        .def("__len__", &SymbolTable::size);
+
+
+    /**
+     * Expose session calendar and multi-day schedules
+     */
+    py::class_<Session>(m, "Session", "Trading session (minutes after midnight)")
+        .def(py::init([](int32_t date, uint16_t open_minute, uint16_t close_minute) {
+            return Session{date, open_minute, close_minute};
+        }), py::arg("date"), py::arg("open_minute") = 570, py::arg("close_minute") = 960)
+        .def_readonly("date", &Session::date)
+        .def_readonly("open_minute", &Session::open_minute)
+        .def_readonly("close_minute", &Session::close_minute)
+        .def_property_readonly("minutes", &Session::minutes);
+
+    py::class_<SessionCalendar>(m, "SessionCalendar", "Trading days with open / close times")
+        .def(py::init<std::vector<Session>>(), py::arg("sessions"))
+        .def_static("weekdays", &SessionCalendar::weekdays,
+            py::arg("first_date"), py::arg("last_date"), py::arg("holidays") = std::vector<int32_t>{},
+            py::arg("half_days") = std::vector<int32_t>{}, py::arg("open_minute") = 570,
+            py::arg("close_minute") = 960, py::arg("half_day_close") = 780,
+            "Mon-Fri in [first_date, last_date] (yyyymmdd) minus holidays")
+        .def("index_of", &SessionCalendar::index_of, py::arg("date"), "First session on or after date")
+        .def("minutes_between", &SessionCalendar::minutes_between, py::arg("first"), py::arg("last"))
+        .def("__getitem__", [](const SessionCalendar& cal, size_t i) {
+            if (i >= cal.size()) {
+                throw py::index_error();
+            }
+            return cal[i];
+        })
+        .def("__len__", &SessionCalendar::size);
+
+    py::enum_<SessionBudget>(m, "SessionBudget")
+        .value("ByMinutes", SessionBudget::ByMinutes)
+        .value("Equal", SessionBudget::Equal);
+
+    py::class_<MultiDayOrder>(m, "MultiDayOrder", "Parent order spanning several sessions")
+        .def(py::init([](int32_t start_date, uint32_t num_sessions, double quantity, uint16_t start_minute) {
+            return MultiDayOrder{start_date, num_sessions, quantity, start_minute};
+        }), py::arg("start_date"), py::arg("num_sessions"), py::arg("quantity"), py::arg("start_minute") = 0)
+        .def_readwrite("start_date", &MultiDayOrder::start_date)
+        .def_readwrite("num_sessions", &MultiDayOrder::num_sessions)
+        .def_readwrite("quantity", &MultiDayOrder::quantity)
+        .def_readwrite("start_minute", &MultiDayOrder::start_minute, "0 = at the open");
+
+    py::class_<ScheduleConfig>(m, "ScheduleConfig", "Slice length and per-session budget")
+        .def(py::init<>())
+        .def_readwrite("slice_minutes", &ScheduleConfig::slice_minutes)
+        .def_readwrite("budget", &ScheduleConfig::budget)
+        .def_readwrite("num_threads", &ScheduleConfig::num_threads, "0 = hardware concurrency");
+
+    py::class_<Schedule>(m, "Schedule", "Slices of many orders, order-major columns")
+        .def_readonly("session", &Schedule::session)
+        .def_readonly("minute", &Schedule::minute)
+        .def_readonly("quantity", &Schedule::quantity)
+        .def_readonly("order_offsets", &Schedule::order_offsets, "First slice of each order, plus total")
+        .def("__len__", &Schedule::size);
+
+    m.def("build_schedules", &build_schedules,
+        py::arg("calendar"),
+        py::arg("orders"),
+        py::arg("config") = ScheduleConfig(),
+        py::call_guard<py::gil_scoped_release>(),
+        "Session-aware slice schedules for many multi-day orders in one pass\n"
+    );
+
+
+    /**
+     * Expose cache-blocked slice sweep
+     */
+    py::class_<SweepConfig>(m, "SweepConfig", "Slice counts and tiling of the slippage sweep")
+        .def(py::init<>())
+        .def_readwrite("slice_counts", &SweepConfig::slice_counts)
+        .def_readwrite("direction", &SweepConfig::direction)
+        .def_readwrite("block_size", &SweepConfig::block_size, "Start indices per tile, 0 = no tiling")
+        .def_readwrite("num_threads", &SweepConfig::num_threads, "0 = hardware concurrency");
+
+    // (slice counts, starts) NumPy views kept alive by the grid
+    auto grid_view = [](py::object self, const std::vector<double>& values) {
+        const SweepGrid& grid = self.cast<const SweepGrid&>();
+        return py::array_t<double>({grid.slice_counts.size(), grid.num_starts},
+                                   {grid.num_starts * sizeof(double), sizeof(double)}, values.data(), self);
+    };
+    py::class_<SweepGrid>(m, "SweepGrid", "TWAP / VWAP slippage (bps) per slice count and start index")
+        .def_readonly("slice_counts", &SweepGrid::slice_counts)
+        .def_readonly("num_starts", &SweepGrid::num_starts)
+        .def_property_readonly("twap_bps", [grid_view](py::object self) {
+            return grid_view(self, self.cast<const SweepGrid&>().twap_bps);
+        }, "NaN where the window runs past the data")
+        .def_property_readonly("vwap_bps", [grid_view](py::object self) {
+            return grid_view(self, self.cast<const SweepGrid&>().vwap_bps);
+        });
+
+    py::class_<SliceStats>(m, "SliceStats", "Slippage mean / std of one slice count over all starts")
+        .def_readonly("num_slices", &SliceStats::num_slices)
+        .def_readonly("count", &SliceStats::count)
+        .def_readonly("twap_mean_bps", &SliceStats::twap_mean_bps)
+        .def_readonly("twap_std_bps", &SliceStats::twap_std_bps)
+        .def_readonly("vwap_mean_bps", &SliceStats::vwap_mean_bps)
+        .def_readonly("vwap_std_bps", &SliceStats::vwap_std_bps);
+
+    m.def("sweep_slices", &sweep_slices,
+        py::arg("prices"),
+        py::arg("volumes"),
+        py::arg("config") = SweepConfig(),
+        py::call_guard<py::gil_scoped_release>(),
+        "Cache-blocked TWAP / VWAP slippage for every (slice count, start index)\n"
+    );
+
+    m.def("sweep_slice_stats", &sweep_slice_stats,
+        py::arg("prices"),
+        py::arg("volumes"),
+        py::arg("config") = SweepConfig(),
+        py::call_guard<py::gil_scoped_release>(),
+        "Same sweep reduced to mean / std per slice count\n"
+    );
+
+
+    /**
+     * Expose SIMD-across-orders batch slippage
+     */
+    py::class_<BatchSlippage>(m, "BatchSlippage", "Per-order TWAP / VWAP slippage (bps)")
+        .def_readonly("twap_bps", &BatchSlippage::twap_bps)
+        .def_readonly("vwap_bps", &BatchSlippage::vwap_bps);
+
+    m.def("batch_slippage",
+        py::overload_cast<const std::vector<double>&, const std::vector<double>&, const std::vector<size_t>&,
+                          size_t, const std::string&, size_t, size_t>(&batch_slippage),
+        py::arg("prices"),
+        py::arg("volumes"),
+        py::arg("starts"),
+        py::arg("num_slices"),
+        py::arg("direction") = "buy",
+        py::arg("lanes") = 4,
+        py::arg("num_threads") = 0,
+        py::call_guard<py::gil_scoped_release>(),
+        "Many short orders evaluated 4 / 8 / 16 at a time, one per vector lane\n"
+    );
+
+    /**
+     * Expose the fused parse + clean loader
+     */
+    py::enum_<NanPolicy>(m, "NanPolicy")
+        .value("Keep", NanPolicy::Keep)
+        .value("Zero", NanPolicy::Zero)
+        .value("ForwardFill", NanPolicy::ForwardFill)
+        .value("DropRow", NanPolicy::DropRow);
+
+    py::class_<CleanConfig>(m, "CleanConfig", "NaN policies applied at load")
+        .def(py::init<>())
+        .def_readwrite("price_nan", &CleanConfig::price_nan)
+        .def_readwrite("volume_nan", &CleanConfig::volume_nan)
+        .def_readwrite("require_increasing_dates", &CleanConfig::require_increasing_dates);
+
+    py::class_<BitMask>(m, "BitMask", "One bit per bar")
+        .def("test", [](const BitMask& mask, size_t i) {
+            if (i >= mask.size()) {
+                throw std::out_of_range("mask index out of range");
+            }
+            return mask.test(i);
+        }, py::arg("i"))
+        .def("count", py::overload_cast<size_t, size_t>(&BitMask::count, py::const_), py::arg("begin"), py::arg("end"))
+        .def("count", py::overload_cast<>(&BitMask::count, py::const_))
+        .def("any", &BitMask::any, py::arg("begin"), py::arg("end"))
+        .def("to_list", [](const BitMask& mask) {
+            std::vector<bool> bits(mask.size());
+            for (size_t i = 0; i < mask.size(); ++i) {
+                bits[i] = mask.test(i);
+            }
+            return bits;
+        }, "Every bit, as a list of bool")
+        .def("__len__", &BitMask::size);
+
+    py::class_<CleanReport>(m, "CleanReport", "What the cleaning pass found")
+        .def_readonly("rows", &CleanReport::rows)
+        .def_readonly("nan_prices", &CleanReport::nan_prices)
+        .def_readonly("nan_volumes", &CleanReport::nan_volumes)
+        .def_readonly("dropped_rows", &CleanReport::dropped_rows)
+        .def_readonly("zero_volume_rows", &CleanReport::zero_volume_rows)
+        .def_readonly("first_traded", &CleanReport::first_traded);
+
+    py::class_<CleanData>(m, "CleanData", "Bars validated and cleaned once, at load")
+        .def_readonly("bars", &CleanData::bars)
+        .def_readonly("has_volume", &CleanData::has_volume)
+        .def_readonly("report", &CleanData::report)
+        .def_readonly("config", &CleanData::config);
+
+    m.def("load_market_data", &load_market_data,
+        py::arg("path"),
+        py::arg("config") = CleanConfig(),
+        py::call_guard<py::gil_scoped_release>(),
+        "Read an OHLCV CSV and clean it in the same pass\n"
+    );
+
+    m.def("parse_market_data", &parse_market_data,
+        py::arg("csv"),
+        py::arg("config") = CleanConfig(),
+        py::call_guard<py::gil_scoped_release>(),
+        "Same, from CSV text\n"
+    );
+
+    m.def("clean_market_data", &clean_market_data,
+        py::arg("bars"),
+        py::arg("config") = CleanConfig(),
+        py::call_guard<py::gil_scoped_release>(),
+        "Apply the NaN policies to bars already in memory\n"
+    );
+
+    m.def("batch_slippage",
+        py::overload_cast<const CleanData&, const std::vector<size_t>&, size_t, const std::string&, size_t, size_t>(&batch_slippage),
+        py::arg("data"),
+        py::arg("starts"),
+        py::arg("num_slices"),
+        py::arg("direction") = "buy",
+        py::arg("lanes") = 4,
+        py::arg("num_threads") = 0,
+        py::call_guard<py::gil_scoped_release>(),
+        "Same over bars cleaned at load (close prices), no per-slice volume checks\n"
+    );
+
 }
\ No newline at end of file
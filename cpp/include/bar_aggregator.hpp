@@ -0,0 +1,86 @@
+#pragma once
+
+#include <market_data.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace execution {
+
+enum class BarKind {
+    Time,       // threshold = bar length in ns, bars aligned on multiples of it
+    Volume,     // threshold = shares per bar
+    Dollar,     // threshold = price * size per bar
+};
+
+struct BarSpec {
+    BarKind kind = BarKind::Time;
+    double threshold = 60e9;
+};
+
+/**
+ * Streaming tick-to-bar aggregation
+ *
+ * Every spec keeps one open bar; each tick updates all of them in the same
+ * pass and closed bars are appended to that spec's MarketData columns. With
+ * reserve() sized for the run, closing a bar never allocates.
+ *
+ * Volume / dollar bars close on the tick that reaches the threshold (ticks
+ * are not split). Bar timestamps are the bar's start: the aligned bucket for
+ * time bars, the first tick for volume / dollar bars. Ticks with a non-finite
+ * price or a non-finite / non-positive size are skipped. Thresholds must be
+ * finite and positive, and time bar lengths must fit in int64 ns.
+ */
+class BarAggregator {
+private:
+    struct OpenBar {
+        int64_t start = 0;
+        double open = 0.0;
+        double high = 0.0;
+        double low = 0.0;
+        double close = 0.0;
+        double volume = 0.0;
+        double accumulated = 0.0;   // volume or notional towards the threshold
+        bool active = false;
+    };
+
+    std::vector<BarSpec> specs_;
+    std::vector<int64_t> intervals_;    // time bars, ns
+    std::vector<OpenBar> open_;
+    std::vector<MarketData> bars_;
+    size_t num_ticks_ = 0;
+    size_t num_skipped_ = 0;
+
+    void close_bar(size_t s);
+
+public:
+    explicit BarAggregator(std::vector<BarSpec> specs);
+
+    // Capacity for closed bars, for every spec or for spec s
+    void reserve(size_t bars_per_spec);
+    void reserve(size_t s, size_t num_bars);
+
+    void on_tick(int64_t timestamp, double price, double size);
+    void on_ticks(const int64_t* timestamps, const double* price, const double* size, size_t n);
+    void on_ticks(const TickData& ticks);
+
+    // Emit the open bars (end of stream / session)
+    void flush();
+
+    // Drop closed bars, keep capacity and open bars
+    void clear_bars();
+
+    // Move the closed bars out (one MarketData per spec)
+    std::vector<MarketData> release_bars();
+
+    size_t num_specs() const { return specs_.size(); }
+    const BarSpec& spec(size_t s) const { return specs_[s]; }
+    const MarketData& bars(size_t s) const { return bars_[s]; }
+    size_t num_ticks() const { return num_ticks_; }
+    size_t num_skipped() const { return num_skipped_; }
+};
+
+// One-shot helper: all specs over a tick array, open bars flushed at the end
+std::vector<MarketData> aggregate_bars(const TickData& ticks, const std::vector<BarSpec>& specs);
+
+} // namespace execution
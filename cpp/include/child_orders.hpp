@@ -0,0 +1,127 @@
+#pragma once
+
+#include <flat_hash_map.hpp>
+#include <intrusive_list.hpp>
+#include <object_pool.hpp>
+#include <order_book.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace execution {
+
+// Order lifecycle, shared by parent and child orders
+enum class OrderState : uint8_t {
+    New,                // sent, not yet acknowledged
+    Acked,
+    PartiallyFilled,
+    Filled,
+    Cancelled,
+    Rejected,
+};
+
+inline bool is_terminal(OrderState state) {
+    return state == OrderState::Filled || state == OrderState::Cancelled || state == OrderState::Rejected;
+}
+
+struct ChildFill {
+    uint64_t child_id;
+    uint64_t timestamp;
+    int64_t price;
+    uint32_t quantity;
+    ListHook<ChildFill> child_hook;
+
+    ChildFill(uint64_t child, uint64_t ts, int64_t px, uint32_t qty)
+        : child_id(child), timestamp(ts), price(px), quantity(qty) {}
+};
+
+struct ChildOrder {
+    uint64_t id;
+    uint64_t parent_id;
+    Side side;
+    int64_t price;
+    uint32_t quantity;
+    uint32_t filled = 0;
+    OrderState state = OrderState::New;
+    bool working = true;                // in its level queue
+    bool cancel_pending = false;        // Cancel sent, venue has not answered yet
+    ListHook<ChildOrder> level_hook;
+    ListHook<ChildOrder> parent_hook;
+    IntrusiveList<ChildFill, &ChildFill::child_hook> fills;
+
+    ChildOrder(uint64_t order_id, uint64_t parent, Side s, int64_t px, uint32_t qty)
+        : id(order_id), parent_id(parent), side(s), price(px), quantity(qty) {}
+
+    uint32_t remaining() const { return quantity - filled; }
+};
+
+using LevelQueue = IntrusiveList<ChildOrder, &ChildOrder::level_hook>;
+using ChildList = IntrusiveList<ChildOrder, &ChildOrder::parent_hook>;
+
+/**
+ * Child orders and their fills on pooled records
+ *
+ * Every child is threaded through its price level's time-priority queue and
+ * through its parent's list of children; fills hang off their child. Records
+ * come from fixed-capacity pools and the id / level / parent indexes are
+ * reserved up front, so create, amend, fill, cancel and release do not
+ * allocate (until more than max_levels levels or max_parents parents are in
+ * use at once, when the indexes grow).
+ */
+class ChildOrderStore {
+private:
+    ObjectPool<ChildOrder> orders_;
+    ObjectPool<ChildFill> fills_;
+    FlatHashMap<ChildOrder*> by_id_;
+    FlatHashMap<LevelQueue> levels_;
+    FlatHashMap<ChildList> parents_;
+    uint64_t next_id_ = 1;
+
+    static uint64_t level_key(Side side, int64_t price) {
+        return (static_cast<uint64_t>(price) << 1) | (side == Side::Sell ? 1u : 0u);
+    }
+
+    void join_level(ChildOrder& order);
+    void leave_level(ChildOrder& order);
+
+public:
+    ChildOrderStore(size_t max_orders, size_t max_fills, size_t max_levels = 256, size_t max_parents = 256);
+
+    // New working child at the back of its level; nullptr when the pool is exhausted
+    ChildOrder* create(uint64_t parent_id, Side side, int64_t price, uint32_t quantity);
+
+    /**
+     * New total quantity and/or price. A price change or a size increase loses
+     * time priority (back of the level), a size decrease keeps it. False if
+     * the child is not working or quantity would not exceed what is filled.
+     */
+    bool amend(ChildOrder& order, int64_t price, uint32_t quantity);
+
+    /**
+     * Apply a fill (capped at the remaining quantity); a completed child leaves
+     * its level. Returns the fill record, nullptr if nothing was filled or the
+     * fill pool is exhausted (the child's filled quantity is updated anyway).
+     */
+    ChildFill* fill(ChildOrder& order, uint32_t quantity, int64_t price, uint64_t timestamp);
+
+    // Stop working: leaves its level, stays with its parent until released
+    void cancel(ChildOrder& order);
+
+    // Return the child and its fills to the pools
+    void release(ChildOrder& order);
+
+    ChildOrder* find(uint64_t id);
+
+    // Visit every child in the pool (working or not), in pool order
+    template <typename Fn>
+    void for_each(Fn&& fn) { orders_.for_each(fn); }
+
+    // nullptr when no child rests there / the parent has no children
+    const LevelQueue* level(Side side, int64_t price) const { return levels_.find(level_key(side, price)); }
+    const ChildList* children(uint64_t parent_id) const { return parents_.find(parent_id); }
+
+    size_t num_orders() const { return orders_.size(); }
+    size_t num_fills() const { return fills_.size(); }
+    size_t order_capacity() const { return orders_.capacity(); }
+};
+
+} // namespace execution
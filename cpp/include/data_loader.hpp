@@ -0,0 +1,94 @@
+#pragma once
+
+#include "market_data.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace execution {
+
+// What to do with a missing (NaN / empty) field
+enum class NanPolicy : uint8_t {
+    Keep,                       // leave NaN in the column
+    Zero,
+    ForwardFill,                // last valid value; a row with nothing to fill from is dropped
+    DropRow,
+};
+
+struct CleanConfig {
+    NanPolicy price_nan = NanPolicy::ForwardFill;   // open / high / low / close
+    NanPolicy volume_nan = NanPolicy::Zero;         // negative / infinite volumes count as missing
+    bool require_increasing_dates = true;           // throw on out-of-order or duplicate timestamps
+};
+
+// One bit per bar, 64 bars per word
+class BitMask {
+private:
+    std::vector<uint64_t> words_;
+    size_t size_ = 0;
+
+public:
+    BitMask() = default;
+    explicit BitMask(size_t n) : words_((n + 63) / 64, 0), size_(n) {}
+
+    void push_back(bool bit) {
+        if (size_ % 64 == 0) {
+            words_.push_back(0);
+        }
+        words_.back() |= uint64_t{bit} << (size_ % 64);
+        ++size_;
+    }
+    void set(size_t i) { words_[i / 64] |= uint64_t{1} << (i % 64); }
+    bool test(size_t i) const { return (words_[i / 64] >> (i % 64)) & 1; }
+
+    // Set bits in [begin, end), a popcount per word; throws if end > size()
+    size_t count(size_t begin, size_t end) const;
+    size_t count() const { return count(0, size_); }
+    bool any(size_t begin, size_t end) const { return count(begin, end) > 0; }
+    bool all(size_t begin, size_t end) const { return count(begin, end) == end - begin; }
+
+    size_t size() const { return size_; }
+    const std::vector<uint64_t>& words() const { return words_; }
+};
+
+struct CleanReport {
+    size_t rows = 0;                // rows read
+    size_t nan_prices = 0;          // missing price fields
+    size_t nan_volumes = 0;         // missing, negative or infinite volumes
+    size_t dropped_rows = 0;
+    size_t zero_volume_rows = 0;    // kept rows without volume, after cleaning
+    size_t first_traded = 0;        // first kept row with volume > 0 (bars.size() if none)
+};
+
+/**
+ * Bars validated and cleaned once, at load
+ *
+ * After cleaning, volumes are finite and >= 0 (unless volume_nan is Keep),
+ * prices follow price_nan and timestamps are strictly increasing, so strategy
+ * kernels can skip per-slice NaN checks; has_volume marks the bars that
+ * traded (the early history of some indices has no volume at all).
+ */
+struct CleanData {
+    MarketData bars;
+    BitMask has_volume;
+    CleanReport report;
+    CleanConfig config;             // policies the bars were cleaned with
+};
+
+// Apply the policies to bars already in memory, one pass
+CleanData clean_market_data(const MarketData& bars, const CleanConfig& config = CleanConfig());
+
+/**
+ * Read an OHLCV CSV and clean it in the same pass
+ * Columns are found by header name (Date, Open, High, Low, Close, Volume; any
+ * order, others ignored); dates may be M/D/YYYY or YYYY-MM-DD and are stored as
+ * yyyymmdd. Empty or unparsable numbers count as missing.
+ */
+CleanData load_market_data(const std::string& path, const CleanConfig& config = CleanConfig());
+
+// Same, from CSV text already in memory
+CleanData parse_market_data(const std::string& csv, const CleanConfig& config = CleanConfig());
+
+} // namespace execution
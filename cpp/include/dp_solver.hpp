@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace execution {
+
+// Per-step cost of trading s shares: fixed_cost * (s > 0) + eta * s * (s / V_t)^beta
+// plus risk_aversion * sigma^2 * remaining^2 for inventory carried to the next step
+struct DPCostModel {
+    double eta = 0.1;
+    double beta = 0.5;              // 0.5 = square-root law, 1 = linear price impact
+    double fixed_cost = 0.0;        // per non-zero trade, makes the problem non-convex
+    double risk_aversion = 0.0;
+    double sigma = 0.0;             // price volatility per step
+
+    // Negative eta or risk_aversion makes the stage costs concave
+    bool convex() const { return fixed_cost == 0.0 && beta >= 0.0 && eta >= 0.0 && risk_aversion >= 0.0; }
+};
+
+struct DPConfig {
+    size_t num_steps = 200;
+    size_t num_lots = 10'000;           // inventory grid 0..num_lots
+    double lot_size = 100.0;            // shares per lot
+    std::vector<double> volume_profile; // expected volume per step, empty = 1 everywhere
+    size_t num_threads = 0;             // used by the exhaustive (non-convex) path
+};
+
+struct DPSchedule {
+    std::vector<double> trades;     // shares per step
+    double expected_cost;           // value function at (t = 0, full inventory)
+    bool used_convex_path;
+};
+
+/**
+ * Bertsimas-Lo style backward induction over (time, remaining lots)
+ *
+ * V_t(q) = min_{x <= q} c_t(x) + h(q - x) + V_{t+1}(q - x), V_T(q > 0) = inf
+ * Convex costs: each stage is a min-plus convolution of convex sequences, done
+ * in O(Q) by merging their slopes. Otherwise an exhaustive O(Q^2) stage with a
+ * contiguous, vectorizable inner loop split across a WorkerPool started once
+ * per solve. Non-finite cost parameters or lot_size throw std::invalid_argument.
+ */
+DPSchedule solve_optimal_schedule(const DPConfig& config, const DPCostModel& model);
+
+// Force the exhaustive path (reference for the convex one, or for non-convex costs)
+DPSchedule solve_optimal_schedule_exhaustive(const DPConfig& config, const DPCostModel& model);
+
+} // namespace execution
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace execution {
+
+/**
+ * Forward-mode dual number: value + N partial derivatives
+ * Any kernel templated on its numeric type returns exact gradients when run with Dual<N>
+ */
+template <size_t N>
+struct Dual {
+    double v;
+    std::array<double, N> d;
+
+    Dual() : v(0.0), d{} {}
+    Dual(double value) : v(value), d{} {}      // constant (implicit so double literals mix in)
+
+    // Independent variable number i
+    static Dual variable(double value, size_t i) {
+        Dual x(value);
+        x.d[i] = 1.0;
+        return x;
+    }
+
+    Dual& operator+=(const Dual& o) { v += o.v; for (size_t i = 0; i < N; ++i) d[i] += o.d[i]; return *this; }
+    Dual& operator-=(const Dual& o) { v -= o.v; for (size_t i = 0; i < N; ++i) d[i] -= o.d[i]; return *this; }
+    Dual& operator*=(const Dual& o) { *this = *this * o; return *this; }
+    Dual& operator/=(const Dual& o) { *this = *this / o; return *this; }
+
+    friend Dual operator+(Dual a, const Dual& b) { return a += b; }
+    friend Dual operator-(Dual a, const Dual& b) { return a -= b; }
+    friend Dual operator-(const Dual& a) {
+        Dual r;
+        r.v = -a.v;
+        for (size_t i = 0; i < N; ++i) r.d[i] = -a.d[i];
+        return r;
+    }
+    friend Dual operator*(const Dual& a, const Dual& b) {
+        Dual r;
+        r.v = a.v * b.v;
+        for (size_t i = 0; i < N; ++i) r.d[i] = a.d[i] * b.v + a.v * b.d[i];
+        return r;
+    }
+    friend Dual operator/(const Dual& a, const Dual& b) {
+        Dual r;
+        r.v = a.v / b.v;
+        double inv_b2 = 1.0 / (b.v * b.v);
+        for (size_t i = 0; i < N; ++i) r.d[i] = (a.d[i] * b.v - a.v * b.d[i]) * inv_b2;
+        return r;
+    }
+};
+
+// Chain rule helper: f(a) with f'(a) = df
+template <size_t N>
+Dual<N> chain(const Dual<N>& a, double f, double df) {
+    Dual<N> r(f);
+    for (size_t i = 0; i < N; ++i) r.d[i] = df * a.d[i];
+    return r;
+}
+
+template <size_t N> Dual<N> sqrt(const Dual<N>& a) { double s = std::sqrt(a.v); return chain(a, s, 0.5 / s); }
+template <size_t N> Dual<N> exp(const Dual<N>& a) { double e = std::exp(a.v); return chain(a, e, e); }
+template <size_t N> Dual<N> expm1(const Dual<N>& a) { return chain(a, std::expm1(a.v), std::exp(a.v)); }
+template <size_t N> Dual<N> log(const Dual<N>& a) { return chain(a, std::log(a.v), 1.0 / a.v); }
+template <size_t N> Dual<N> sinh(const Dual<N>& a) { return chain(a, std::sinh(a.v), std::cosh(a.v)); }
+template <size_t N> Dual<N> cosh(const Dual<N>& a) { return chain(a, std::cosh(a.v), std::sinh(a.v)); }
+
+// Plain value of either numeric type (for branching inside templated kernels)
+inline double value(double x) { return x; }
+template <size_t N> double value(const Dual<N>& x) { return x.v; }
+
+} // namespace execution
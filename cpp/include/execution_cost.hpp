@@ -0,0 +1,170 @@
+#pragma once
+
+#include <order.hpp>
+#include <dual.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace execution {
+
+// Parameters we differentiate with respect to
+template <typename T>
+struct CostParams {
+    T eta;              // temporary impact, bps per 100% participation
+    T risk_aversion;    // schedule urgency (Almgren-Chriss lambda, 1/bps)
+};
+
+// Fixed evaluation settings
+struct CostModel {
+    double sigma_bps = 100.0;           // price volatility per slice
+    double variance_penalty = 1e-4;     // weight of holding risk in the objective (1/bps)
+};
+
+template <typename T>
+struct ExecutionCost {
+    T cost_bps;         // realized price drift + impact, per unit of arrival notional
+    T risk_bps;         // variance_penalty * sigma^2 * sum of squared holdings
+    T objective_bps;    // cost + risk
+};
+
+/**
+ * Trades per slice of one schedule, plus its risk term
+ *
+ * Both depend on the parameters and slice count only, not on the window, so a
+ * history pass builds them once instead of per start.
+ */
+template <typename T>
+struct CostSchedule {
+    std::vector<T> traded;
+    T risk;             // variance_penalty * sigma^2 * sum of squared holdings
+};
+
+/**
+ * Almgren-Chriss style schedule
+ *
+ * Holdings follow sinh(kappa (n - j)) / sinh(kappa n), kappa = sqrt(lambda sigma^2 / eta).
+ * Templated on the numeric type: run with Dual<N> for exact parameter gradients.
+ *
+ * The ratio is evaluated as exp(-kappa j) expm1(-2 kappa (n - j)) / expm1(-2 kappa n),
+ * which stays finite where sinh overflows (kappa n > ~710). Near the TWAP limit
+ * (kappa n < 1e-3) it is a series in q = kappa^2, so d/d lambda stays exact
+ * down to lambda = 0 instead of dropping to zero.
+ */
+template <typename T>
+CostSchedule<T> cost_schedule(size_t n, const CostParams<T>& params, const CostModel& model) {
+    using std::exp;
+    using std::expm1;
+    using std::sqrt;
+
+    CostSchedule<T> schedule;
+    schedule.traded.resize(n);
+
+    double sigma2 = model.sigma_bps * model.sigma_bps;
+    double nd = static_cast<double>(n);
+    T q = params.risk_aversion * sigma2 / params.eta;      // kappa^2
+    bool series = value(q) * nd * nd < 1e-6;
+
+    // sinh(kappa m) / sinh(kappa n) = (m / n) (1 + q m^2 / 6 + q^2 m^4 / 120) / (same in n) + O(q^3)
+    auto sinh_series = [&](double m) { return 1.0 + q * (m * m / 6.0) + q * q * (m * m * m * m / 120.0); };
+    T kappa = series ? T(0.0) : sqrt(q);
+    T denom = series ? sinh_series(nd) : expm1(kappa * (-2.0 * nd));
+
+    T risk(0.0);
+    T prev_holding(1.0);
+    for (size_t j = 1; j <= n; ++j) {
+        double remaining = static_cast<double>(n - j);
+        T holding = series ? (remaining / nd) * sinh_series(remaining) / denom
+                           : exp(kappa * -static_cast<double>(j)) * expm1(kappa * (-2.0 * remaining)) / denom;
+        schedule.traded[j - 1] = prev_holding - holding;
+        risk += holding * holding;
+        prev_holding = holding;
+    }
+    schedule.risk = risk * (model.variance_penalty * sigma2);
+    return schedule;
+}
+
+/**
+ * Schedule evaluated on one window of history
+ * Slice j trades at prices[j], pays eta * participation on top.
+ * Volumes must be positive over the window.
+ */
+template <typename T>
+ExecutionCost<T> execution_cost(
+    const double* prices,
+    const double* volumes,
+    double size,
+    double sign,
+    const CostParams<T>& params,
+    const CostSchedule<T>& schedule
+) {
+    double benchmark = prices[0];
+    double to_bps = sign * 10000.0 / benchmark;
+    T cost(0.0);
+    for (size_t j = 0; j < schedule.traded.size(); ++j) {
+        const T& traded = schedule.traded[j];
+        double drift_bps = (prices[j] - benchmark) * to_bps;
+        T participation = traded * (size / volumes[j]);
+        cost += traded * (drift_bps + params.eta * participation);
+    }
+    return ExecutionCost<T>{cost, schedule.risk, cost + schedule.risk};
+}
+
+// Single window, n slices: builds the schedule and evaluates it
+template <typename T>
+ExecutionCost<T> execution_cost(
+    const double* prices,
+    const double* volumes,
+    size_t n,
+    double size,
+    double sign,
+    const CostParams<T>& params,
+    const CostModel& model
+) {
+    return execution_cost(prices, volumes, size, sign, params, cost_schedule<T>(n, params, model));
+}
+
+// Mean objective over every start index and its exact gradient
+struct CostGradient {
+    double objective_bps;
+    double cost_bps;
+    double risk_bps;
+    double d_eta;
+    double d_risk_aversion;
+    uint64_t count;         // windows evaluated (zero-volume windows are skipped)
+};
+
+CostGradient history_cost_gradient(
+    const std::vector<double>& prices,
+    const std::vector<double>& volumes,
+    const Order& order,
+    double eta,
+    double risk_aversion,
+    const CostModel& model = CostModel(),
+    size_t num_threads = 0
+);
+
+struct TuningResult {
+    double risk_aversion;
+    double objective_bps;
+    double d_eta;               // sensitivity to the impact assumption at the optimum
+    int iterations;
+};
+
+/**
+ * Gradient descent on log(risk_aversion) over the whole history, eta held fixed
+ * One dual-number pass per step instead of 2 runs per parameter
+ */
+TuningResult tune_risk_aversion(
+    const std::vector<double>& prices,
+    const std::vector<double>& volumes,
+    const Order& order,
+    double eta,
+    double initial_risk_aversion,
+    const CostModel& model = CostModel(),
+    int max_iterations = 50,
+    size_t num_threads = 0
+);
+
+} // namespace execution
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace execution {
+
+class WorkerPool;
+
+struct EnvConfig {
+    size_t num_envs = 1024;         // parallel episodes
+    size_t horizon = 20;            // decisions (days) per episode
+    double order_size = 100'000.0;  // shares to buy per episode
+    double eta = 20.0;              // temporary impact, bps per 100% participation
+    uint64_t seed = 42;
+    size_t num_threads = 1;         // > 1 splits each step across a pool the env keeps
+};
+
+/**
+ * Vectorized Gym-style execution environment over daily history
+ *
+ * N independent buy episodes in structure-of-arrays buffers. Each step the agent
+ * trades a fraction of its remaining shares at the close, paying drift vs the
+ * arrival price plus eta * participation. Whatever is left at the horizon is
+ * forced out. Finished episodes restart immediately at a new random start index.
+ *
+ * Observation (OBS_DIM floats): remaining fraction, time left fraction,
+ * price move since arrival (bps / 100), volume / 20d average volume
+ * Reward: -(cost of this step in bps of arrival notional)
+ */
+class ExecutionEnv {
+private:
+    std::vector<double> prices_;
+    std::vector<double> volumes_;
+    std::vector<double> volume_ratio_;
+    std::vector<uint32_t> valid_starts_;    // windows with volume and a valid price on every day
+    EnvConfig config_;
+
+    // SoA episode state
+    std::vector<uint32_t> start_;
+    std::vector<uint32_t> step_;
+    std::vector<double> remaining_;
+    std::vector<double> arrival_;
+    std::vector<double> episode_cost_;
+    std::vector<uint64_t> rng_;
+
+    // Output buffers (reused every step)
+    std::vector<float> obs_;
+    std::vector<float> rewards_;
+    std::vector<uint8_t> dones_;
+    std::vector<float> last_episode_cost_;
+
+    std::unique_ptr<WorkerPool> pool_;      // started once, null when single-threaded
+
+    void reset_env(size_t i);
+    void write_obs(size_t i);
+    void step_range(const float* actions, size_t begin, size_t end);
+
+public:
+    static constexpr size_t OBS_DIM = 4;
+
+    ExecutionEnv(const std::vector<double>& prices, const std::vector<double>& volumes, const EnvConfig& config = EnvConfig());
+    ~ExecutionEnv();
+
+    void reset();
+    void step(const float* actions);        // num_envs actions, fraction of remaining in [0, 1], non-finite holds
+
+    const float* observations() const { return obs_.data(); }
+    const float* rewards() const { return rewards_.data(); }
+    const uint8_t* dones() const { return dones_.data(); }
+    const float* last_episode_costs() const { return last_episode_cost_.data(); }  // bps, set when done
+
+    size_t num_envs() const { return config_.num_envs; }
+    size_t num_valid_starts() const { return valid_starts_.size(); }
+    const EnvConfig& config() const { return config_; }
+};
+
+} // namespace execution
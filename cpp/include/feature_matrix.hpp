@@ -0,0 +1,67 @@
+#pragma once
+
+#include <market_data.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace execution {
+
+// Each feature at row i only looks at bars <= i, NaN until enough history
+// (rolling features are also NaN while their window holds a non-finite input)
+enum class FeatureKind {
+    Return,         // close[i] / close[i - window] - 1
+    LogReturn,      // log(close[i] / close[i - window])
+    RollingVol,     // stdev of daily log returns over the last `window` days
+    VolumeRatio,    // volume[i] / mean volume over the last `window` days
+    Range,          // (high - low) / close
+    Gap,            // open[i] / close[i - 1] - 1
+    ParkinsonVol,   // high/low range volatility over the last `window` days
+};
+
+struct FeatureSpec {
+    FeatureKind kind;
+    size_t window;
+};
+
+enum class MatrixLayout { RowMajor, ColumnMajor };
+
+struct FeatureMatrix {
+    size_t rows = 0;                    // sum of bars over symbols, symbol-major
+    size_t cols = 0;
+    MatrixLayout layout = MatrixLayout::RowMajor;
+    std::vector<double> data;
+    std::vector<size_t> symbol_offsets; // first row of each symbol, plus total
+
+    double at(size_t row, size_t col) const {
+        return layout == MatrixLayout::RowMajor ? data[row * cols + col] : data[col * rows + row];
+    }
+};
+
+/**
+ * Configurable feature pipeline over every (symbol, date)
+ *
+ * Rows are cut in blocks small enough that the input columns and the block's
+ * output stay in cache; every feature of a block is computed before moving on,
+ * blocks run in parallel and write straight into the final matrix.
+ */
+class FeatureMatrixBuilder {
+private:
+    std::vector<FeatureSpec> features_;
+
+public:
+    static constexpr size_t BLOCK_ROWS = 2048;
+
+    FeatureMatrixBuilder& add(FeatureKind kind, size_t window = 1);
+
+    FeatureMatrix build(
+        const std::vector<MarketData>& symbols,
+        MatrixLayout layout = MatrixLayout::RowMajor,
+        size_t num_threads = 0
+    ) const;
+
+    std::vector<std::string> names() const;
+    size_t num_features() const { return features_.size(); }
+};
+
+} // namespace execution
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace execution {
+
+/**
+ * Open-addressing hash map from 64-bit ids (order ids) to V
+ *
+ * Robin Hood linear probing over a power-of-two table: an insert takes the
+ * slot of any resident closer to its home than the newcomer is, so probe
+ * lengths stay short and even. Deletion shifts the following cluster back by
+ * one slot instead of leaving tombstones, so heavy add/cancel churn never
+ * degrades lookups. Keys and values sit in one flat array, probe distances in
+ * a separate compact array that is checked first.
+ *
+ * Pointers returned by find / insert are invalidated by any insert or erase.
+ */
+template <typename V>
+class FlatHashMap {
+private:
+    struct Slot {
+        uint64_t key;
+        V value;
+    };
+
+    std::vector<Slot> slots_;
+    std::vector<uint16_t> dist_;    // 0 = empty, else probe distance + 1
+    size_t size_ = 0;
+    size_t mask_ = 0;
+    unsigned shift_ = 64;
+
+    static constexpr size_t MIN_CAPACITY = 16;
+
+    // Fibonacci hashing: sequential ids spread over the whole table
+    size_t home(uint64_t key) const {
+        return static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> shift_);
+    }
+
+    void rehash(size_t capacity) {
+        std::vector<Slot> old_slots(capacity);
+        std::vector<uint16_t> old_dist(capacity, 0);
+        old_slots.swap(slots_);
+        old_dist.swap(dist_);
+        mask_ = capacity - 1;
+        shift_ = 64;
+        for (size_t c = capacity; c > 1; c >>= 1) {
+            --shift_;
+        }
+        size_ = 0;
+        for (size_t i = 0; i < old_slots.size(); ++i) {
+            if (old_dist[i] != 0) {
+                insert(old_slots[i].key, std::move(old_slots[i].value));
+            }
+        }
+    }
+
+public:
+    FlatHashMap() { rehash(MIN_CAPACITY); }
+
+    explicit FlatHashMap(size_t expected) { reserve(expected); }
+
+    // Room for `n` entries without growing (max load 7/8)
+    void reserve(size_t n) {
+        size_t capacity = MIN_CAPACITY;
+        while (capacity * 7 / 8 < n) {
+            capacity *= 2;
+        }
+        if (capacity > slots_.size()) {
+            rehash(capacity);
+        }
+    }
+
+    // Insert if absent; returns the value slot and whether it was inserted
+    std::pair<V*, bool> insert(uint64_t key, V value) {
+        size_t idx = home(key);
+        uint16_t d = 1;
+        // existing key: it must be found before any slot closer to home
+        while (dist_[idx] >= d) {
+            if (dist_[idx] == d && slots_[idx].key == key) {
+                return {&slots_[idx].value, false};
+            }
+            idx = (idx + 1) & mask_;
+            ++d;
+        }
+        if ((size_ + 1) * 8 > slots_.size() * 7) {
+            rehash(slots_.size() * 2);
+            return insert(key, std::move(value));
+        }
+        // place here, pushing richer residents further along
+        V* placed = &slots_[idx].value;
+        Slot carry{key, std::move(value)};
+        while (dist_[idx] != 0) {
+            if (dist_[idx] < d) {
+                std::swap(carry, slots_[idx]);
+                std::swap(d, dist_[idx]);
+            }
+            idx = (idx + 1) & mask_;
+            ++d;
+        }
+        slots_[idx] = std::move(carry);
+        dist_[idx] = d;
+        ++size_;
+        return {placed, true};
+    }
+
+    V* find(uint64_t key) {
+        size_t idx = home(key);
+        for (uint16_t d = 1; dist_[idx] >= d; ++d) {
+            if (dist_[idx] == d && slots_[idx].key == key) {
+                return &slots_[idx].value;
+            }
+            idx = (idx + 1) & mask_;
+        }
+        return nullptr;
+    }
+
+    const V* find(uint64_t key) const {
+        return const_cast<FlatHashMap*>(this)->find(key);
+    }
+
+    bool contains(uint64_t key) const { return find(key) != nullptr; }
+
+    // Backward-shift deletion; false if absent
+    bool erase(uint64_t key) {
+        size_t idx = home(key);
+        uint16_t d = 1;
+        while (true) {
+            if (dist_[idx] < d) {
+                return false;
+            }
+            if (dist_[idx] == d && slots_[idx].key == key) {
+                break;
+            }
+            idx = (idx + 1) & mask_;
+            ++d;
+        }
+        size_t next = (idx + 1) & mask_;
+        while (dist_[next] > 1) {
+            slots_[idx] = std::move(slots_[next]);
+            dist_[idx] = static_cast<uint16_t>(dist_[next] - 1);
+            idx = next;
+            next = (next + 1) & mask_;
+        }
+        dist_[idx] = 0;
+        slots_[idx].value = V{};
+        --size_;
+        return true;
+    }
+
+    void clear() {
+        for (size_t i = 0; i < slots_.size(); ++i) {
+            if (dist_[i] != 0) {
+                dist_[i] = 0;
+                slots_[i].value = V{};
+            }
+        }
+        size_ = 0;
+    }
+
+    // fn(key, value) for every entry, in table order
+    template <typename Fn>
+    void for_each(Fn&& fn) {
+        for (size_t i = 0; i < slots_.size(); ++i) {
+            if (dist_[i] != 0) {
+                fn(slots_[i].key, slots_[i].value);
+            }
+        }
+    }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    size_t capacity() const { return slots_.size(); }
+};
+
+} // namespace execution
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace execution {
+
+// cost_bps = intercept + coefficient * sigma_bps * (size / adv)^exponent
+enum class ImpactModelKind {
+    Linear,         // exponent fixed at 1
+    SquareRoot,     // exponent fixed at 0.5
+    PowerLaw,       // exponent fitted: log-log regression on fills with positive cost
+};
+
+// Fill records, one entry per fill (structure of arrays)
+struct FillRecords {
+    std::vector<double> size;           // shares filled
+    std::vector<double> adv;            // average daily volume, shares
+    std::vector<double> volatility;     // daily volatility, fraction (0.02 = 2%)
+    std::vector<double> cost_bps;       // realized cost vs arrival, bps
+
+    size_t count() const { return size.size(); }
+};
+
+struct ImpactFit {
+    ImpactModelKind kind;
+    double coefficient;
+    double exponent;
+    double intercept_bps;       // spread-like fixed cost (0 for PowerLaw)
+    double r_squared;           // in log space for PowerLaw; uncentered when no intercept is fit
+    uint64_t num_fills;         // fills used (invalid rows are skipped)
+};
+
+/**
+ * Least-squares fit of an impact model to our own fills
+ *
+ * Each thread accumulates X'X and X'y over its share of the fills, the partial
+ * sums are added and the small normal-equation system is solved by Cholesky.
+ * One pass over the data, memory independent of the number of fills.
+ */
+ImpactFit calibrate_impact(
+    const FillRecords& fills,
+    ImpactModelKind kind,
+    bool fit_intercept = true,
+    size_t num_threads = 0
+);
+
+// Model prediction for one order
+double predict_impact_bps(const ImpactFit& fit, double size, double adv, double volatility);
+
+} // namespace execution
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <market_data.hpp>
+#include <parallel.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace execution {
+
+struct IntradayConfig {
+    size_t minutes_per_day = 390;       // 09:30 - 16:00
+    double volume_u_depth = 2.0;        // open/close volume vs midday (1 + depth at the edges, >= -1)
+    uint64_t seed = 1;
+    size_t num_threads = 0;
+};
+
+/**
+ * Synthetic minute bars consistent with each day's OHLCV
+ *
+ * Price path: piecewise Brownian bridges through Open -> High / Low (random
+ * times) -> Close, clamped to [Low, High], so the day's first open, last close,
+ * max and min match the daily bar exactly. Volume follows a U-shaped profile
+ * summing to the daily volume.
+ *
+ * Randomness is counter-based (seed, day, step): any day can be generated by any
+ * thread, in any order, with identical output.
+ */
+class IntradayBarGenerator {
+private:
+    const MarketData& daily_;
+    IntradayConfig config_;
+    std::vector<double> volume_profile_;    // per minute, sums to 1
+
+    void bridge(uint64_t key, size_t t0, double v0, size_t t1, double v1, double step_sigma, double* path) const;
+
+public:
+    static constexpr int64_t MINUTE_NS = 60'000'000'000;
+    static constexpr int64_t DAY_NS = 24 * 60 * MINUTE_NS;
+    static constexpr size_t OPEN_MINUTE = 9 * 60 + 30;                 // 09:30
+    static constexpr size_t MAX_MINUTES = 24 * 60 - OPEN_MINUTE;      // session closes by midnight
+
+    // OHLCV columns must have the same length; timestamps (yyyymmdd) may be empty
+    IntradayBarGenerator(const MarketData& daily, const IntradayConfig& config = IntradayConfig());
+
+    // Minute bars of one day into out (cleared first, capacity reused), stamped in ns since the epoch
+    void generate_day(size_t day, MarketData& out) const;
+
+    /**
+     * Generate days [begin, end) in parallel and hand each one to
+     * consume(day, bars, thread_id) as soon as it exists; bars is a per-thread
+     * buffer reused for the next day, nothing is kept
+     */
+    template <typename Consumer>
+    void stream(Consumer&& consume, size_t begin, size_t end) const {
+        end = std::min(end, daily_.size());
+        if (begin >= end) {
+            return;
+        }
+        parallel_for(end - begin, config_.num_threads, [&](size_t tid, size_t first, size_t last) {
+            MarketData bars;
+            bars.reserve(config_.minutes_per_day);
+            for (size_t d = begin + first; d < begin + last; ++d) {
+                generate_day(d, bars);
+                consume(d, static_cast<const MarketData&>(bars), tid);
+            }
+        });
+    }
+
+    template <typename Consumer>
+    void stream(Consumer&& consume) const {
+        stream(std::forward<Consumer>(consume), 0, daily_.size());
+    }
+
+    size_t num_days() const { return daily_.size(); }
+    const IntradayConfig& config() const { return config_; }
+};
+
+/**
+ * Intraday TWAP replay on generated bars: each day's order is cut into
+ * slices_per_day equal slices spread over the session, filled at minute closes.
+ * Returns slippage vs the day's open (bps) per day; bars are never stored.
+ */
+std::vector<double> intraday_twap_slippage(
+    const MarketData& daily,
+    size_t slices_per_day,
+    const IntradayConfig& config = IntradayConfig()
+);
+
+} // namespace execution
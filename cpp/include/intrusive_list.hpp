@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstddef>
+
+namespace execution {
+
+// Links embedded in T; one hook per list T can belong to
+template <typename T>
+struct ListHook {
+    T* prev = nullptr;
+    T* next = nullptr;
+    bool linked = false;
+};
+
+/**
+ * Doubly-linked list threaded through ListHook members of T
+ *
+ * The list never owns or allocates its elements: push and remove only rewire
+ * pointers, and an element can sit in as many lists as it has hooks (e.g. a
+ * child order in its price level and in its parent's children). Removing any
+ * element is O(1) given the element.
+ */
+template <typename T, ListHook<T> T::*Hook>
+class IntrusiveList {
+private:
+    T* head_ = nullptr;
+    T* tail_ = nullptr;
+    size_t size_ = 0;
+
+    static ListHook<T>& hook(T& x) { return x.*Hook; }
+
+public:
+    class iterator {
+    private:
+        T* node_;
+
+    public:
+        explicit iterator(T* node) : node_(node) {}
+        T& operator*() const { return *node_; }
+        T* operator->() const { return node_; }
+        iterator& operator++() {
+            node_ = (node_->*Hook).next;
+            return *this;
+        }
+        bool operator==(const iterator& other) const { return node_ == other.node_; }
+        bool operator!=(const iterator& other) const { return node_ != other.node_; }
+    };
+
+    IntrusiveList() = default;
+
+    // Moving transfers the chain (elements point at each other, not at the list)
+    IntrusiveList(IntrusiveList&& other) noexcept
+        : head_(other.head_), tail_(other.tail_), size_(other.size_) {
+        other.head_ = other.tail_ = nullptr;
+        other.size_ = 0;
+    }
+
+    IntrusiveList& operator=(IntrusiveList&& other) noexcept {
+        if (this != &other) {
+            head_ = other.head_;
+            tail_ = other.tail_;
+            size_ = other.size_;
+            other.head_ = other.tail_ = nullptr;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    void push_back(T& x) {
+        ListHook<T>& h = hook(x);
+        h.prev = tail_;
+        h.next = nullptr;
+        h.linked = true;
+        if (tail_ != nullptr) {
+            hook(*tail_).next = &x;
+        } else {
+            head_ = &x;
+        }
+        tail_ = &x;
+        ++size_;
+    }
+
+    void push_front(T& x) {
+        ListHook<T>& h = hook(x);
+        h.prev = nullptr;
+        h.next = head_;
+        h.linked = true;
+        if (head_ != nullptr) {
+            hook(*head_).prev = &x;
+        } else {
+            tail_ = &x;
+        }
+        head_ = &x;
+        ++size_;
+    }
+
+    // x must be in this list
+    void remove(T& x) {
+        ListHook<T>& h = hook(x);
+        if (h.prev != nullptr) {
+            hook(*h.prev).next = h.next;
+        } else {
+            head_ = h.next;
+        }
+        if (h.next != nullptr) {
+            hook(*h.next).prev = h.prev;
+        } else {
+            tail_ = h.prev;
+        }
+        h.prev = h.next = nullptr;
+        h.linked = false;
+        --size_;
+    }
+
+    T* pop_front() {
+        T* x = head_;
+        if (x != nullptr) {
+            remove(*x);
+        }
+        return x;
+    }
+
+    T* front() const { return head_; }
+    T* back() const { return tail_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    iterator begin() const { return iterator(head_); }
+    iterator end() const { return iterator(nullptr); }
+};
+
+} // namespace execution
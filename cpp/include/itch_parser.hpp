@@ -0,0 +1,306 @@
+#pragma once
+
+#include <order_book.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace execution {
+
+/**
+ * Big-endian field loads
+ */
+inline uint16_t load_be16(const uint8_t* p) {
+    uint16_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return __builtin_bswap16(v);
+}
+
+inline uint32_t load_be32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return __builtin_bswap32(v);
+}
+
+inline uint64_t load_be64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return __builtin_bswap64(v);
+}
+
+// 6-byte ITCH timestamp (ns since midnight)
+inline uint64_t load_be48(const uint8_t* p) {
+    return (uint64_t{load_be16(p)} << 32) | load_be32(p + 2);
+}
+
+/**
+ * Messages (ITCH 5.0 layouts)
+ */
+// 'A' (36 bytes) and 'F' (40, with MPID attribution)
+struct ItchAdd {
+    uint16_t locate;
+    uint64_t timestamp;
+    uint64_t order_ref;
+    Side side;
+    uint32_t shares;
+    uint32_t price;
+    char stock[8];
+};
+
+// 'E' (31 bytes) and 'C' (36, execution at a price other than the order's)
+struct ItchExecute {
+    uint16_t locate;
+    uint64_t timestamp;
+    uint64_t order_ref;
+    uint32_t shares;
+    uint64_t match_number;
+    uint32_t price;     // only meaningful when has_price
+    bool has_price;
+};
+
+// 'X' (23 bytes): partial cancel
+struct ItchCancel {
+    uint16_t locate;
+    uint64_t timestamp;
+    uint64_t order_ref;
+    uint32_t shares;
+};
+
+// 'D' (19 bytes): full delete
+struct ItchDelete {
+    uint16_t locate;
+    uint64_t timestamp;
+    uint64_t order_ref;
+};
+
+// 'U' (35 bytes): cancel-replace
+struct ItchReplace {
+    uint16_t locate;
+    uint64_t timestamp;
+    uint64_t original_ref;
+    uint64_t new_ref;
+    uint32_t shares;
+    uint32_t price;
+};
+
+struct ItchStats {
+    size_t messages = 0;
+    size_t adds = 0;
+    size_t executes = 0;
+    size_t cancels = 0;
+    size_t deletes = 0;
+    size_t replaces = 0;
+    size_t skipped = 0;     // other message types, or too short for their type
+    size_t bytes = 0;       // consumed, framing included
+    bool truncated = false; // stream ended inside a message
+};
+
+/**
+ * Decode a length-prefixed ITCH stream (2-byte big-endian length, then the
+ * message) and hand each order event to the handler
+ *
+ * Handler is any type with some of on_add / on_execute / on_cancel / on_delete /
+ * on_replace taking the message structs above; dispatch is resolved at compile
+ * time (no virtual calls) and message types it has no hook for are only counted.
+ */
+template <typename Handler>
+ItchStats parse_itch(const uint8_t* data, size_t size, Handler& handler) {
+    ItchStats stats;
+    size_t pos = 0;
+    while (pos + 2 <= size) {
+        size_t len = load_be16(data + pos);
+        if (pos + 2 + len > size) {
+            break;
+        }
+        const uint8_t* msg = data + pos + 2;
+        pos += 2 + len;
+        ++stats.messages;
+        if (len == 0) {
+            ++stats.skipped;
+            continue;
+        }
+
+        uint16_t locate = len >= 11 ? load_be16(msg + 1) : 0;
+        uint64_t timestamp = len >= 11 ? load_be48(msg + 5) : 0;
+
+        switch (msg[0]) {
+        case 'A':
+        case 'F':
+            if (len < 36) {
+                ++stats.skipped;
+                break;
+            }
+            ++stats.adds;
+            if constexpr (requires(ItchAdd m) { handler.on_add(m); }) {
+                ItchAdd m{locate, timestamp, load_be64(msg + 11), msg[19] == 'S' ? Side::Sell : Side::Buy,
+                          load_be32(msg + 20), load_be32(msg + 32), {}};
+                std::memcpy(m.stock, msg + 24, sizeof(m.stock));
+                handler.on_add(m);
+            }
+            break;
+        case 'E':
+        case 'C': {
+            bool has_price = msg[0] == 'C';
+            if (len < (has_price ? 36u : 31u)) {
+                ++stats.skipped;
+                break;
+            }
+            ++stats.executes;
+            if constexpr (requires(ItchExecute m) { handler.on_execute(m); }) {
+                handler.on_execute(ItchExecute{locate, timestamp, load_be64(msg + 11), load_be32(msg + 19),
+                                               load_be64(msg + 23), has_price ? load_be32(msg + 32) : 0, has_price});
+            }
+            break;
+        }
+        case 'X':
+            if (len < 23) {
+                ++stats.skipped;
+                break;
+            }
+            ++stats.cancels;
+            if constexpr (requires(ItchCancel m) { handler.on_cancel(m); }) {
+                handler.on_cancel(ItchCancel{locate, timestamp, load_be64(msg + 11), load_be32(msg + 19)});
+            }
+            break;
+        case 'D':
+            if (len < 19) {
+                ++stats.skipped;
+                break;
+            }
+            ++stats.deletes;
+            if constexpr (requires(ItchDelete m) { handler.on_delete(m); }) {
+                handler.on_delete(ItchDelete{locate, timestamp, load_be64(msg + 11)});
+            }
+            break;
+        case 'U':
+            if (len < 35) {
+                ++stats.skipped;
+                break;
+            }
+            ++stats.replaces;
+            if constexpr (requires(ItchReplace m) { handler.on_replace(m); }) {
+                handler.on_replace(ItchReplace{locate, timestamp, load_be64(msg + 11), load_be64(msg + 19),
+                                               load_be32(msg + 27), load_be32(msg + 31)});
+            }
+            break;
+        default:
+            ++stats.skipped;
+            break;
+        }
+    }
+    stats.bytes = pos;
+    stats.truncated = pos < size;
+    return stats;
+}
+
+// Read-only memory map of a whole file (POSIX), unmapped on destruction
+class MappedFile {
+private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+
+public:
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const uint8_t* data() const { return data_; }
+    size_t size() const { return size_; }
+};
+
+template <typename Handler>
+ItchStats parse_itch_file(const std::string& path, Handler& handler) {
+    MappedFile file(path);
+    return parse_itch(file.data(), file.size(), handler);
+}
+
+// Encoder for the same message subset, used to generate sample files
+class ItchWriter {
+private:
+    std::vector<uint8_t> buffer_;
+
+    uint8_t* begin_message(char type, size_t len, uint16_t locate, uint64_t timestamp);
+
+public:
+    void add(uint16_t locate, uint64_t timestamp, uint64_t order_ref, Side side, uint32_t shares, uint32_t price, const char* stock = "");
+    void execute(uint16_t locate, uint64_t timestamp, uint64_t order_ref, uint32_t shares, uint64_t match_number);
+    void cancel(uint16_t locate, uint64_t timestamp, uint64_t order_ref, uint32_t shares);
+    void remove(uint16_t locate, uint64_t timestamp, uint64_t order_ref);
+    void replace(uint16_t locate, uint64_t timestamp, uint64_t original_ref, uint64_t new_ref, uint32_t shares, uint32_t price);
+
+    const std::vector<uint8_t>& bytes() const { return buffer_; }
+    void clear() { buffer_.clear(); }
+    void save(const std::string& path) const;
+};
+
+/**
+ * ITCH handler maintaining one OrderBook per stock locate code
+ *
+ * Events for orders the book never saw are counted in unknown_refs(). Books
+ * live in a deque, so references from book() stay valid as new locates appear.
+ */
+class ItchBookReplay {
+private:
+    std::deque<OrderBook> books_;
+    size_t unknown_refs_ = 0;
+
+    OrderBook* find_book(uint16_t locate) {
+        return locate < books_.size() ? &books_[locate] : nullptr;
+    }
+
+public:
+    void on_add(const ItchAdd& m) {
+        if (m.locate >= books_.size()) {
+            books_.resize(size_t{m.locate} + 1);
+        }
+        if (!books_[m.locate].add(m.order_ref, m.side, m.price, m.shares)) {
+            ++unknown_refs_;
+        }
+    }
+
+    void on_execute(const ItchExecute& m) {
+        OrderBook* book = find_book(m.locate);
+        if (book == nullptr || book->execute(m.order_ref, m.shares) == 0) {
+            ++unknown_refs_;
+        }
+    }
+
+    void on_cancel(const ItchCancel& m) {
+        OrderBook* book = find_book(m.locate);
+        if (book == nullptr || book->cancel(m.order_ref, m.shares) == 0) {
+            ++unknown_refs_;
+        }
+    }
+
+    void on_delete(const ItchDelete& m) {
+        OrderBook* book = find_book(m.locate);
+        if (book == nullptr || !book->remove(m.order_ref)) {
+            ++unknown_refs_;
+        }
+    }
+
+    void on_replace(const ItchReplace& m) {
+        OrderBook* book = find_book(m.locate);
+        if (book == nullptr || !book->replace(m.original_ref, m.new_ref, m.price, m.shares)) {
+            ++unknown_refs_;
+        }
+    }
+
+    // Book of a locate code (created empty if never seen)
+    OrderBook& book(uint16_t locate) {
+        if (locate >= books_.size()) {
+            books_.resize(size_t{locate} + 1);
+        }
+        return books_[locate];
+    }
+
+    size_t num_books() const { return books_.size(); }
+    size_t unknown_refs() const { return unknown_refs_; }
+};
+
+} // namespace execution
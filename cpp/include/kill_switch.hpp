@@ -0,0 +1,33 @@
+#pragma once
+
+#include <atomic>
+
+namespace execution {
+
+/**
+ * Engine-wide stop flag for child order generation
+ *
+ * Checked on every slice decision, so it is read far more often than
+ * written: the flag owns a whole cache line and nothing written on the hot
+ * path shares it, so checking stays an L1 hit on every core until it is
+ * triggered. Triggering is one release store, visible to the next check.
+ */
+class KillSwitch {
+private:
+    alignas(64) std::atomic<bool> engaged_{false};
+
+public:
+    bool engaged() const { return engaged_.load(std::memory_order_acquire); }
+    void trigger() { engaged_.store(true, std::memory_order_release); }
+    void reset() { engaged_.store(false, std::memory_order_release); }
+
+    // The instance order managers check unless given their own
+    static KillSwitch& global() {
+        static KillSwitch instance;
+        return instance;
+    }
+};
+
+static_assert(sizeof(KillSwitch) == 64, "kill switch must own exactly one cache line");
+
+} // namespace execution
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <itch_parser.hpp>
+#include <order_book.hpp>
+#include <queue_position.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace execution {
+
+/**
+ * Book tape
+ */
+enum class TapeEventKind : uint8_t { Add, Execute, Cancel };
+
+// One book change with the book state strategies need, resolved once
+struct TapeEvent {
+    uint64_t timestamp;
+    int64_t price;          // level touched by the event
+    int64_t best_bid;       // after the event, 0 if empty
+    int64_t best_ask;
+    uint32_t shares;
+    uint32_t level_before;  // shares resting at `price` before the event
+    uint32_t bid_size;      // at best_bid / best_ask after the event
+    uint32_t ask_size;
+    TapeEventKind kind;
+    Side side;
+};
+
+/**
+ * ITCH handler recording one locate's book changes as TapeEvents
+ *
+ * Deletes and the old half of a replace become Cancel events, the new half
+ * of a replace an Add. Events on unknown orders are dropped.
+ */
+class BookTape {
+private:
+    OrderBook book_;
+    uint16_t locate_;
+    std::vector<TapeEvent> events_;
+
+    void record(uint64_t timestamp, TapeEventKind kind, Side side, int64_t price, uint32_t shares, uint32_t level_before);
+
+public:
+    explicit BookTape(uint16_t locate = 0) : locate_(locate) {}
+
+    void on_add(const ItchAdd& m);
+    void on_execute(const ItchExecute& m);
+    void on_cancel(const ItchCancel& m);
+    void on_delete(const ItchDelete& m);
+    void on_replace(const ItchReplace& m);
+
+    const std::vector<TapeEvent>& events() const { return events_; }
+    const OrderBook& book() const { return book_; }
+};
+
+/**
+ * Passive / aggressive placement
+ */
+struct PlacementConfig {
+    Side side = Side::Buy;
+    uint32_t quantity = 10'000;     // parent order, split evenly over slices
+    uint64_t start_time = 0;        // tape timestamps (ns)
+    uint64_t end_time = 0;
+    size_t num_slices = 10;
+    CancelModel cancel_model = CancelModel::Proportional;
+    size_t num_threads = 0;         // parameterizations are split across threads
+};
+
+struct PlacementParams {
+    double escalate_at = 0.8;       // fraction of the slice after which the rest is taken
+    double max_queue_ratio = 0.0;   // escalate early if queue ahead > ratio * remaining (0 = off)
+};
+
+struct PlacementResult {
+    uint64_t filled = 0;
+    uint64_t passive_filled = 0;
+    uint64_t unfilled = 0;              // left at a deadline with the far side empty; filled + unfilled = quantity
+    double avg_price = 0.0;
+    double slippage_bps = 0.0;          // vs arrival mid, positive = cost
+    double spread_capture_bps = 0.0;    // vs mid at each fill, positive = earned
+};
+
+/**
+ * Slice-by-slice limit placement, evaluated on a book tape
+ *
+ * Each slice's shares are posted at our touch (queue ahead = touch size) and
+ * follow the touch when it moves away. Queue ahead is consumed as in
+ * QueueTracker. Once `escalate_at` of the slice has elapsed, or the queue ahead
+ * is too long for what is left, the remainder is taken at the far touch; the
+ * slice deadline always takes the remainder. Aggressive fills are priced at the
+ * far touch (book depth is not walked). An escalation that finds the far side
+ * empty retries on later events; at the deadline those shares count as unfilled.
+ *
+ * All parameterizations advance together: one pass over the tape, with the
+ * small per-parameterization state updated for each event.
+ */
+std::vector<PlacementResult> sweep_limit_strategy(
+    const std::vector<TapeEvent>& tape,
+    const PlacementConfig& config,
+    const std::vector<PlacementParams>& params
+);
+
+} // namespace execution
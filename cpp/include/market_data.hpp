@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace execution {
+
+// Columnar OHLCV bars: one contiguous array per field
+struct MarketData {
+    std::vector<int64_t> timestamps;    // yyyymmdd for daily bars, ns for intraday bars
+    std::vector<double> open;
+    std::vector<double> high;
+    std::vector<double> low;
+    std::vector<double> close;
+    std::vector<double> volume;
+
+    size_t size() const { return close.size(); }
+    bool empty() const { return close.empty(); }
+
+    void reserve(size_t n) {
+        timestamps.reserve(n);
+        open.reserve(n);
+        high.reserve(n);
+        low.reserve(n);
+        close.reserve(n);
+        volume.reserve(n);
+    }
+
+    void clear() {
+        timestamps.clear();
+        open.clear();
+        high.clear();
+        low.clear();
+        close.clear();
+        volume.clear();
+    }
+
+    void push_back(int64_t ts, double o, double h, double l, double c, double v) {
+        timestamps.push_back(ts);
+        open.push_back(o);
+        high.push_back(h);
+        low.push_back(l);
+        close.push_back(c);
+        volume.push_back(v);
+    }
+};
+
+// Columnar trade ticks
+struct TickData {
+    std::vector<int64_t> timestamps;    // ns
+    std::vector<double> price;
+    std::vector<double> size;
+
+    size_t count() const { return price.size(); }
+
+    void reserve(size_t n) {
+        timestamps.reserve(n);
+        price.reserve(n);
+        size.reserve(n);
+    }
+
+    void push_back(int64_t ts, double p, double s) {
+        timestamps.push_back(ts);
+        price.push_back(p);
+        size.push_back(s);
+    }
+};
+
+} // namespace execution
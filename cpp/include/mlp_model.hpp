@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace execution {
+
+enum class Activation { Linear, Relu, Tanh, Sigmoid };
+
+struct DenseLayer {
+    size_t in;
+    size_t out;
+    Activation activation;
+    std::vector<float> weights;     // out x in, row-major
+    std::vector<float> bias;        // out
+};
+
+/**
+ * Small feed-forward network for in-loop decisions, no dependencies
+ *
+ * Text weight file, whitespace separated:
+ *     mlp
+ *     dense <in> <out> <linear|relu|tanh|sigmoid>
+ *     <out * in weights, row-major> <out biases>
+ *     dense ...
+ *
+ * predict(): one decision, stack buffers only (no allocation).
+ * predict_batch(): rows processed BATCH_LANES at a time with activations stored
+ * lane-minor, so every multiply-add runs across lanes (compiler vectorizes it).
+ * Both throw std::runtime_error on a default-constructed (layerless) model.
+ */
+class MLPModel {
+private:
+    std::vector<DenseLayer> layers_;
+
+public:
+    static constexpr size_t MAX_WIDTH = 256;    // widest layer supported
+    static constexpr size_t BATCH_LANES = 8;
+
+    MLPModel() = default;
+    explicit MLPModel(std::vector<DenseLayer> layers);
+
+    static MLPModel load(const std::string& path);
+    static MLPModel parse(std::istream& in);
+
+    // out must hold output_dim() floats
+    void predict(const float* x, float* out) const;
+    float predict(const float* x) const;
+
+    // x: n rows of input_dim() (row-major), out: n rows of output_dim()
+    void predict_batch(const float* x, size_t n, float* out) const;
+
+    size_t input_dim() const { return layers_.empty() ? 0 : layers_.front().in; }
+    size_t output_dim() const { return layers_.empty() ? 0 : layers_.back().out; }
+    size_t num_layers() const { return layers_.size(); }
+};
+
+} // namespace execution
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <order.hpp>
+#include <mlp_model.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace execution {
+
+/**
+ * Learned slice sizing: the model sees the same 4 features as ExecutionEnv
+ * (remaining fraction, time left fraction, price move since arrival in bps / 100,
+ * volume / 20d average) and outputs the fraction of remaining shares to trade now.
+ * The last slice always trades what is left.
+ */
+constexpr size_t POLICY_FEATURES = 4;
+
+// One order, decision per slice in the loop (single-row inference)
+ExecutionResult execute_mlp_policy(
+    const std::vector<double>& prices,
+    const std::vector<double>& volumes,
+    const Order& order,
+    size_t start_idx,
+    const MLPModel& model
+);
+
+// Backtest path: slippage (bps) for every start index, one batched inference per slice
+std::vector<double> mlp_policy_slippage(
+    const std::vector<double>& prices,
+    const std::vector<double>& volumes,
+    const Order& order,
+    const MLPModel& model,
+    size_t num_threads = 0
+);
+
+} // namespace execution
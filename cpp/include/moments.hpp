@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace execution {
+
+/**
+ * Mergeable mean / variance accumulator (Welford updates, Chan et al. merge)
+ *
+ * Keeps the centered sum of squares instead of sum(x^2), so the variance does
+ * not cancel when the mean is large next to the spread. Per-thread partials
+ * merge in any order.
+ */
+struct RunningMoments {
+    uint64_t count = 0;
+    double mean = 0.0;
+    double m2 = 0.0;    // sum of squared deviations from mean
+
+    void add(double x) {
+        ++count;
+        double delta = x - mean;
+        mean += delta / static_cast<double>(count);
+        m2 += delta * (x - mean);
+    }
+
+    void merge(const RunningMoments& other) {
+        if (other.count == 0) {
+            return;
+        }
+        if (count == 0) {
+            *this = other;
+            return;
+        }
+        double n_a = static_cast<double>(count);
+        double n_b = static_cast<double>(other.count);
+        double n = n_a + n_b;
+        double delta = other.mean - mean;
+        mean += delta * n_b / n;
+        m2 += other.m2 + delta * delta * n_a * n_b / n;
+        count += other.count;
+    }
+
+    // Two passes over a contiguous batch (mean, then deviations), merged in as one partial
+    void add_batch(const double* x, size_t n) {
+        if (n == 0) {
+            return;
+        }
+        RunningMoments batch;
+        double sum = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            sum += x[i];
+        }
+        batch.count = n;
+        batch.mean = sum / static_cast<double>(n);
+        for (size_t i = 0; i < n; ++i) {
+            double d = x[i] - batch.mean;
+            batch.m2 += d * d;
+        }
+        merge(batch);
+    }
+
+    // 0 below two samples
+    double sample_std() const {
+        return count < 2 ? 0.0 : std::sqrt(m2 / static_cast<double>(count - 1));
+    }
+};
+
+} // namespace execution
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace execution {
+
+/**
+ * Fixed-capacity pool of T
+ *
+ * All storage is allocated once in the constructor; allocate / release only
+ * push and pop a free-index stack, so the order lifecycle never reaches the
+ * heap. allocate() returns nullptr when the pool is exhausted (the hot path
+ * does not throw). Addresses are stable for the lifetime of the pool.
+ */
+template <typename T>
+class ObjectPool {
+private:
+    struct alignas(T) Storage {
+        std::byte bytes[sizeof(T)];
+    };
+
+    std::unique_ptr<Storage[]> storage_;
+    std::vector<uint32_t> free_;    // stack of free slot indices
+    std::vector<uint8_t> live_;
+    size_t capacity_;
+
+    T* slot(size_t index) { return std::launder(reinterpret_cast<T*>(storage_[index].bytes)); }
+
+public:
+    explicit ObjectPool(size_t capacity) : capacity_(capacity) {
+        if (capacity == 0 || capacity > UINT32_MAX) {
+            throw std::invalid_argument("pool capacity must be in [1, 2^32)");
+        }
+        storage_.reset(new Storage[capacity]);
+        live_.assign(capacity, 0);
+        free_.reserve(capacity);
+        for (size_t i = capacity; i-- > 0;) {
+            free_.push_back(static_cast<uint32_t>(i));     // lowest index handed out first
+        }
+    }
+
+    ~ObjectPool() {
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (live_[i]) {
+                slot(i)->~T();
+            }
+        }
+    }
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    template <typename... Args>
+    T* allocate(Args&&... args) {
+        if (free_.empty()) {
+            return nullptr;
+        }
+        uint32_t index = free_.back();
+        free_.pop_back();
+        T* p = new (storage_[index].bytes) T(std::forward<Args>(args)...);
+        live_[index] = 1;
+        return p;
+    }
+
+    void release(T* p) {
+        size_t index = index_of(p);
+        p->~T();
+        live_[index] = 0;
+        free_.push_back(static_cast<uint32_t>(index));
+    }
+
+    size_t index_of(const T* p) const {
+        return static_cast<size_t>(reinterpret_cast<const Storage*>(p) - storage_.get());
+    }
+
+    bool owns(const T* p) const {
+        const Storage* s = reinterpret_cast<const Storage*>(p);
+        return s >= storage_.get() && s < storage_.get() + capacity_ && live_[index_of(p)];
+    }
+
+    // Visit live objects in slot order (one pass over the live flags)
+    template <typename Fn>
+    void for_each(Fn&& fn) {
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (live_[i]) {
+                fn(*slot(i));
+            }
+        }
+    }
+
+    size_t capacity() const { return capacity_; }
+    size_t size() const { return capacity_ - free_.size(); }
+    size_t available() const { return free_.size(); }
+    bool full() const { return free_.empty(); }
+};
+
+} // namespace execution
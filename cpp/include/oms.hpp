@@ -0,0 +1,171 @@
+#pragma once
+
+#include <child_orders.hpp>
+#include <flat_hash_map.hpp>
+#include <kill_switch.hpp>
+#include <object_pool.hpp>
+#include <order.hpp>
+#include <rate_throttle.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace execution {
+
+enum class ReportType : uint8_t { Ack, Fill, Cancel, Reject };
+
+// Execution report from the venue for one child order
+struct ExecutionReport {
+    uint64_t child_id;
+    ReportType type;
+    uint32_t quantity = 0;      // Fill only
+    int64_t price = 0;          // Fill only
+    uint64_t timestamp = 0;
+};
+
+// State machine input: a fill is classified as partial or full against the remaining quantity
+enum class OrderEvent : uint8_t { Ack, PartialFill, FullFill, Cancel, Reject };
+
+inline constexpr size_t NUM_ORDER_STATES = 6;
+inline constexpr size_t NUM_ORDER_EVENTS = 5;
+inline constexpr uint8_t INVALID_TRANSITION = 0xFF;
+
+namespace oms_table {
+constexpr uint8_t N = static_cast<uint8_t>(OrderState::New);
+constexpr uint8_t A = static_cast<uint8_t>(OrderState::Acked);
+constexpr uint8_t P = static_cast<uint8_t>(OrderState::PartiallyFilled);
+constexpr uint8_t F = static_cast<uint8_t>(OrderState::Filled);
+constexpr uint8_t C = static_cast<uint8_t>(OrderState::Cancelled);
+constexpr uint8_t R = static_cast<uint8_t>(OrderState::Rejected);
+constexpr uint8_t X = INVALID_TRANSITION;
+} // namespace oms_table
+
+/**
+ * Next state per [state][event], INVALID_TRANSITION where the event is not
+ * allowed. Fills may arrive before the ack, so the late ack is a no-op on an
+ * acked, partially filled or filled order; other terminal states accept nothing.
+ */
+inline constexpr uint8_t ORDER_TRANSITIONS[NUM_ORDER_STATES][NUM_ORDER_EVENTS] = {
+    //            Ack            PartialFill    FullFill       Cancel         Reject
+    /* N */      {oms_table::A,  oms_table::P,  oms_table::F,  oms_table::C,  oms_table::R},
+    /* A */      {oms_table::A,  oms_table::P,  oms_table::F,  oms_table::C,  oms_table::X},
+    /* P */      {oms_table::P,  oms_table::P,  oms_table::F,  oms_table::C,  oms_table::X},
+    /* F */      {oms_table::F,  oms_table::X,  oms_table::X,  oms_table::X,  oms_table::X},
+    /* C */      {oms_table::X,  oms_table::X,  oms_table::X,  oms_table::X,  oms_table::X},
+    /* R */      {oms_table::X,  oms_table::X,  oms_table::X,  oms_table::X,  oms_table::X},
+};
+
+// Apply event to state; false (state unchanged) if the transition is not allowed
+inline bool transition(OrderState& state, OrderEvent event) {
+    uint8_t next = ORDER_TRANSITIONS[static_cast<size_t>(state)][static_cast<size_t>(event)];
+    if (next == INVALID_TRANSITION) {
+        return false;
+    }
+    state = static_cast<OrderState>(next);
+    return true;
+}
+
+struct ParentOrder {
+    uint64_t id;
+    Side side;
+    uint32_t quantity;
+    uint32_t filled = 0;
+    uint32_t open = 0;                  // sent to the venue, not yet filled or dead
+    OrderState state = OrderState::New;
+    bool cancel_requested = false;
+    double notional = 0.0;              // sum of fill price * quantity
+
+    ParentOrder(uint64_t order_id, Side s, uint32_t qty) : id(order_id), side(s), quantity(qty) {}
+
+    uint32_t remaining() const { return quantity - filled; }
+    // What a strategy may still send as new children
+    uint32_t unallocated() const { return quantity - filled - open; }
+    double avg_price() const { return filled > 0 ? notional / filled : 0.0; }
+};
+
+struct OmsStats {
+    uint64_t reports = 0;
+    uint64_t unknown_orders = 0;        // report for a child id not in the store
+    uint64_t invalid_transitions = 0;   // e.g. a fill after a cancel, a reject after an ack
+    uint64_t killed_sends = 0;          // send_child refused by the kill switch
+};
+
+/**
+ * Order management: parent orders, their children and the execution reports
+ * that drive them
+ *
+ * Children go through the ORDER_TRANSITIONS table on every report; the parent
+ * is driven through the same table by the child events (first ack, fills
+ * classified against the parent's remaining quantity, cancel once a
+ * cancel-requested parent has nothing left open). Parents and children sit on
+ * fixed-capacity pools with pre-reserved id indexes, so applying a report is a
+ * hash lookup, a table lookup and a few field updates - no allocation.
+ *
+ * No child is sent while the kill switch is engaged; cancel_all() then pulls
+ * everything still live at the venue.
+ */
+class OrderManager {
+private:
+    ObjectPool<ParentOrder> parents_;
+    FlatHashMap<ParentOrder*> parent_index_;
+    ChildOrderStore children_;
+    const KillSwitch* kill_switch_;
+    OmsStats stats_;
+    uint64_t next_parent_id_ = 1;
+
+    void child_closed(ParentOrder& parent);
+
+public:
+    OrderManager(size_t max_parents, size_t max_children, size_t max_fills,
+                 const KillSwitch& kill_switch = KillSwitch::global());
+
+    // nullptr when the parent pool is exhausted
+    ParentOrder* new_parent(Side side, uint32_t quantity);
+    // Size rounded to whole shares; throws invalid_argument unless it is in [1, 2^32 - 1]
+    ParentOrder* new_parent(const Order& order);
+
+    /**
+     * New child of parent_id in state New. nullptr if the parent is unknown,
+     * terminal or cancel-requested, quantity is zero or exceeds the
+     * parent's unallocated quantity, the child pool is exhausted or the
+     * kill switch is engaged.
+     */
+    ChildOrder* send_child(uint64_t parent_id, int64_t price, uint32_t quantity);
+
+    // False if the child is unknown or the report is not a valid transition (counted in stats)
+    bool apply(const ExecutionReport& report);
+
+    /**
+     * Stop sending children for parent_id. The parent becomes Cancelled at once
+     * if nothing is open, otherwise when its last open child is filled,
+     * cancelled or rejected; the caller cancels working children at the venue.
+     * Returns the number of open children, -1 if the parent is unknown or terminal.
+     */
+    int cancel_parent(uint64_t parent_id);
+
+    /**
+     * Cancel-request every live parent and append one Cancel per child not yet
+     * terminal to batch (reserve it up front to keep this allocation-free).
+     * Children marked cancel_pending by an earlier call are skipped, so a
+     * repeated kill does not resend. Walks the pools directly rather than the
+     * id indexes. Returns the number of cancels appended.
+     */
+    size_t cancel_all(std::vector<OutboundMessage>& batch);
+
+    // Free a terminal parent and all its children; false if unknown or not terminal
+    bool release_parent(uint64_t parent_id);
+
+    ParentOrder* find_parent(uint64_t parent_id);
+    ChildOrder* find_child(uint64_t child_id) { return children_.find(child_id); }
+    const ChildList* children(uint64_t parent_id) const { return children_.children(parent_id); }
+    const ChildOrderStore& child_store() const { return children_; }
+
+    // Parent quantity not yet filled; 0 for an unknown parent
+    uint32_t remaining(uint64_t parent_id);
+
+    const OmsStats& stats() const { return stats_; }
+    size_t num_parents() const { return parents_.size(); }
+    size_t num_children() const { return children_.num_orders(); }
+};
+
+} // namespace execution
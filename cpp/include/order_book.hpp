@@ -0,0 +1,72 @@
+#pragma once
+
+#include <flat_hash_map.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+
+namespace execution {
+
+enum class Side : uint8_t { Buy, Sell };
+
+struct BookOrder {
+    Side side;
+    int64_t price;      // integer ticks (ITCH: 1/10000 $)
+    uint32_t quantity;  // shares still resting
+};
+
+struct PriceLevel {
+    uint64_t quantity = 0;
+    uint32_t num_orders = 0;
+};
+
+/**
+ * Order-by-order limit book for one instrument
+ *
+ * Resting orders by id plus aggregated price levels per side. Events follow
+ * feed semantics: they reference resting orders by id and never cross the
+ * book themselves. Events for unknown ids (orders placed before the replay
+ * started) are ignored and reported through the return value.
+ */
+class OrderBook {
+private:
+    FlatHashMap<BookOrder> orders_;
+    std::map<int64_t, PriceLevel, std::greater<int64_t>> bids_;    // best first
+    std::map<int64_t, PriceLevel> asks_;                            // best first
+
+    void level_remove(Side side, int64_t price, uint32_t quantity, bool last);
+
+public:
+    // false if the id is already resting
+    bool add(uint64_t id, Side side, int64_t price, uint32_t quantity);
+
+    // Shares actually taken off the order (0 if unknown); a fully executed order is removed
+    uint32_t execute(uint64_t id, uint32_t quantity);
+
+    // Partial cancel, same return convention as execute
+    uint32_t cancel(uint64_t id, uint32_t quantity);
+
+    // Full delete; false if unknown
+    bool remove(uint64_t id);
+
+    // Cancel-replace: old id leaves, new id joins the back of the (new) level;
+    // false (book unchanged) if old id is unknown or new id is already resting
+    bool replace(uint64_t old_id, uint64_t new_id, int64_t price, uint32_t quantity);
+
+    void clear();
+
+    const BookOrder* find(uint64_t id) const;
+
+    // Best price of a side, 0 when that side is empty
+    int64_t best_bid() const { return bids_.empty() ? 0 : bids_.begin()->first; }
+    int64_t best_ask() const { return asks_.empty() ? 0 : asks_.begin()->first; }
+
+    // Aggregated level (empty level if nothing rests there)
+    PriceLevel level(Side side, int64_t price) const;
+
+    size_t num_orders() const { return orders_.size(); }
+    size_t num_levels(Side side) const { return side == Side::Buy ? bids_.size() : asks_.size(); }
+};
+
+} // namespace execution
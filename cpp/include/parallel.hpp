@@ -0,0 +1,155 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace execution {
+
+// 0 = one worker per hardware thread
+inline size_t resolve_num_threads(size_t requested) {
+    if (requested > 0) {
+        return requested;
+    }
+    size_t hw = std::thread::hardware_concurrency();
+    return hw > 0 ? hw : 1;
+}
+
+/**
+ * Split [0, n) in contiguous chunks, one per worker
+ * fn(thread_id, begin, end) runs once per chunk; thread_id indexes per-thread state
+ * Returns the number of workers used (size per-thread reducers with it)
+ */
+template <typename Fn>
+size_t parallel_for(size_t n, size_t num_threads, Fn&& fn) {
+    size_t workers = std::min(resolve_num_threads(num_threads), std::max<size_t>(n, 1));
+    if (workers == 1) {
+        fn(size_t{0}, size_t{0}, n);
+        return 1;
+    }
+
+    size_t chunk = (n + workers - 1) / workers;
+    std::vector<std::thread> pool;
+    pool.reserve(workers - 1);
+    for (size_t t = 1; t < workers; ++t) {
+        size_t begin = std::min(n, t * chunk);
+        size_t end = std::min(n, begin + chunk);
+        pool.emplace_back([&fn, t, begin, end] { fn(t, begin, end); });
+    }
+    // calling thread takes the first chunk
+    fn(size_t{0}, size_t{0}, std::min(n, chunk));
+
+    for (auto& th : pool) {
+        th.join();
+    }
+    return workers;
+}
+
+/**
+ * Persistent workers for a parallel_for issued many times over, e.g. once per
+ * environment step: each call wakes the threads instead of creating them
+ * run(n, fn) splits [0, n) and calls fn exactly like parallel_for; one caller
+ * at a time.
+ */
+class WorkerPool {
+private:
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable start_cv_;
+    std::condition_variable done_cv_;
+    uint64_t generation_ = 0;
+    size_t pending_ = 0;
+    bool stop_ = false;
+
+    // Current call, type-erased without allocating
+    void (*invoke_)(void*, size_t, size_t, size_t) = nullptr;
+    void* fn_ = nullptr;
+    size_t n_ = 0;
+    size_t chunk_ = 0;
+    size_t workers_ = 0;
+
+    void loop(size_t t) {
+        uint64_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            start_cv_.wait(lock, [&] { return stop_ || generation_ != seen; });
+            if (stop_) {
+                return;
+            }
+            seen = generation_;
+            if (t < workers_) {
+                size_t begin = std::min(n_, t * chunk_);
+                size_t end = std::min(n_, begin + chunk_);
+                auto invoke = invoke_;
+                void* fn = fn_;
+                lock.unlock();
+                invoke(fn, t, begin, end);
+                lock.lock();
+            }
+            if (--pending_ == 0) {
+                done_cv_.notify_one();
+            }
+        }
+    }
+
+public:
+    explicit WorkerPool(size_t num_threads) {
+        size_t workers = resolve_num_threads(num_threads);
+        threads_.reserve(workers - 1);
+        for (size_t t = 1; t < workers; ++t) {
+            threads_.emplace_back([this, t] { loop(t); });
+        }
+    }
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        start_cv_.notify_all();
+        for (auto& th : threads_) {
+            th.join();
+        }
+    }
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    size_t size() const { return threads_.size() + 1; }
+
+    template <typename Fn>
+    size_t run(size_t n, Fn&& fn) {
+        size_t workers = std::min(size(), std::max<size_t>(n, 1));
+        if (workers == 1) {
+            fn(size_t{0}, size_t{0}, n);
+            return 1;
+        }
+        size_t chunk = (n + workers - 1) / workers;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            invoke_ = [](void* f, size_t t, size_t begin, size_t end) {
+                (*static_cast<std::remove_reference_t<Fn>*>(f))(t, begin, end);
+            };
+            fn_ = const_cast<void*>(static_cast<const void*>(&fn));
+            n_ = n;
+            chunk_ = chunk;
+            workers_ = workers;
+            pending_ = threads_.size();
+            ++generation_;
+        }
+        start_cv_.notify_all();
+        // calling thread takes the first chunk
+        fn(size_t{0}, size_t{0}, std::min(n, chunk));
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [&] { return pending_ == 0; });
+        return workers;
+    }
+};
+
+} // namespace execution
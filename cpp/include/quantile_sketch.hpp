@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace execution {
+
+/**
+ * KLL quantile sketch (Karnin, Lang, Liberty 2016)
+ *
+ * Streaming, mergeable summary of a distribution: keeps O(k) values instead of
+ * the whole sample. Normalized rank error shrinks as O(1/k), k = 200 gives
+ * roughly 1-2% rank error on any quantile.
+ *
+ * Meant as a per-thread reducer: each worker owns one sketch, the results are
+ * combined with merge() at the end of the run.
+ */
+class QuantileSketch {
+private:
+    size_t k_;
+    uint64_t rng_state_;            // xorshift state for compaction offsets
+
+    std::vector<std::vector<double>> levels_;   // level h items weigh 2^h
+    size_t num_retained_;
+    size_t max_retained_;
+
+    uint64_t count_;
+    double min_;
+    double max_;
+
+    size_t level_capacity(size_t level) const;
+    size_t total_capacity() const;
+    bool random_bit();
+    void compress();
+
+    // (value, weight) pairs sorted by value
+    std::vector<std::pair<double, uint64_t>> sorted_view() const;
+
+public:
+    static constexpr size_t DEFAULT_K = 200;
+
+    explicit QuantileSketch(size_t k = DEFAULT_K, uint64_t seed = 0x9E3779B97F4A7C15ULL);
+
+    void update(double value);
+    void update(const std::vector<double>& values);
+
+    // Fold another sketch into this one (sketches may use different k; may be *this)
+    void merge(const QuantileSketch& other);
+
+    // Value at normalized rank q in [0, 1]
+    double quantile(double q) const;
+    std::vector<double> quantiles(const std::vector<double>& qs) const;
+
+    // Fraction of the stream <= value
+    double rank(double value) const;
+
+    uint64_t count() const { return count_; }
+    bool empty() const { return count_ == 0; }
+    double min() const { return min_; }
+    double max() const { return max_; }
+    size_t k() const { return k_; }
+    size_t num_retained() const { return num_retained_; }
+};
+
+} // namespace execution
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <itch_parser.hpp>
+#include <order_book.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace execution {
+
+// Where market cancels at our level are assumed to come from
+enum class CancelModel {
+    Behind,         // pessimistic: only cancels larger than the queue behind us move us up
+    Ahead,          // optimistic: every cancel moves us up
+    Proportional,   // cancel * ahead / level size comes from ahead of us
+};
+
+// Queue ahead of us after `shares` are cancelled from a level holding `level` shares
+inline double ahead_after_cancel(CancelModel model, double ahead, double level, double shares) {
+    switch (model) {
+    case CancelModel::Behind: {
+        double behind = level > ahead ? level - ahead : 0.0;
+        if (shares > behind) {
+            ahead -= shares - behind;
+        }
+        break;
+    }
+    case CancelModel::Ahead:
+        ahead -= shares;
+        break;
+    case CancelModel::Proportional:
+        if (level > 0.0) {
+            ahead -= shares * ahead / level;
+        }
+        break;
+    }
+    double cap = level > shares ? level - shares : 0.0;
+    return ahead < 0.0 ? 0.0 : (ahead > cap ? cap : ahead);
+}
+
+struct PassiveOrder {
+    uint64_t id;
+    Side side;
+    int64_t price;
+    uint32_t quantity;
+    uint32_t filled = 0;
+    double ahead = 0.0;     // estimated shares queued in front of us
+    bool active = true;
+
+    uint32_t remaining() const { return quantity - filled; }
+};
+
+struct QueueFill {
+    uint64_t id;
+    uint64_t timestamp;
+    int64_t price;
+    uint32_t quantity;
+};
+
+/**
+ * Queue-position simulation for our own passive orders on a replayed feed
+ *
+ * Our orders are virtual: they never enter the market book. Each one joins
+ * the back of its level (ahead = level size when posted) and one counter per
+ * level is updated per event:
+ *   - executions at our level consume the queue ahead first, the rest fills us
+ *   - cancels at our level shrink the queue ahead according to CancelModel
+ *   - adds join behind us
+ * Executions at a worse price than ours, or opposite-side adds that cross our
+ * price, mean we were traded through and fill us directly.
+ *
+ * One own order per (side, price) level. Per event the cost is one book
+ * lookup plus one level lookup; the trade-through check scans own orders only
+ * (a handful in practice).
+ */
+class QueueTracker {
+private:
+    OrderBook book_;
+    uint16_t locate_;
+    CancelModel model_;
+    std::vector<PassiveOrder> own_;                         // by id - 1
+    std::unordered_map<int64_t, size_t> bid_levels_;        // price -> own_ index
+    std::unordered_map<int64_t, size_t> ask_levels_;
+    std::vector<size_t> active_;                            // own_ indices still working
+    std::vector<QueueFill> fills_;
+
+    std::unordered_map<int64_t, size_t>& levels(Side side) { return side == Side::Buy ? bid_levels_ : ask_levels_; }
+    PassiveOrder* own_at(Side side, int64_t price);
+    void fill(PassiveOrder& order, uint32_t quantity, uint64_t timestamp);
+    void deactivate(PassiveOrder& order);
+    void on_level_cancel(Side side, int64_t price, uint32_t shares);
+    void on_level_execute(Side side, int64_t price, uint32_t shares, uint64_t timestamp);
+
+public:
+    explicit QueueTracker(uint16_t locate = 0, CancelModel model = CancelModel::Proportional);
+
+    // Post at the back of a level; throws if it would cross or the level already has our order
+    uint64_t post(Side side, int64_t price, uint32_t quantity);
+
+    // Pull an own order; false if unknown or already done
+    bool cancel(uint64_t id);
+
+    // ITCH hooks (events for other locates are ignored)
+    void on_add(const ItchAdd& m);
+    void on_execute(const ItchExecute& m);
+    void on_cancel(const ItchCancel& m);
+    void on_delete(const ItchDelete& m);
+    void on_replace(const ItchReplace& m);
+
+    const PassiveOrder& order(uint64_t id) const { return own_.at(id - 1); }
+    const OrderBook& book() const { return book_; }
+    const std::vector<QueueFill>& fills() const { return fills_; }
+    void clear_fills() { fills_.clear(); }
+    size_t num_active() const { return active_.size(); }
+    CancelModel model() const { return model_; }
+};
+
+} // namespace execution
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+namespace execution {
+
+// SplitMix64 step: cheap, statistically solid, one uint64 of state
+inline uint64_t splitmix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Uniform double in [0, 1) from the top 53 bits
+inline double to_unit(uint64_t bits) {
+    return static_cast<double>(bits >> 11) * 0x1.0p-53;
+}
+
+// Counter-based draw: pure function of (key, counter), no shared state, so any
+// thread can reproduce element `counter` of stream `key` in any order
+inline uint64_t counter_random(uint64_t key, uint64_t counter) {
+    uint64_t state = key * 0xD1B54A32D192ED03ULL + counter;
+    return splitmix64(state);
+}
+
+// Standard normal via Box-Muller on two counter draws
+inline double counter_normal(uint64_t key, uint64_t counter) {
+    double u1 = to_unit(counter_random(key, 2 * counter)) + 0x1.0p-54;     // avoid log(0)
+    double u2 = to_unit(counter_random(key, 2 * counter + 1));
+    return std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+}
+
+} // namespace execution
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <flat_hash_map.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace execution {
+
+/**
+ * Cheap monotonic tick source for the throttle hot path
+ *
+ * The time-stamp counter on x86 (invariant on any recent CPU, ~20 cycles, no
+ * syscall), steady_clock nanoseconds elsewhere. The tick rate is calibrated
+ * once against steady_clock on first use.
+ */
+struct TscClock {
+    static uint64_t now() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    static double ticks_per_second();
+};
+
+/**
+ * Lock-free token bucket as a generic cell rate algorithm (GCRA)
+ *
+ * The whole bucket is one atomic "theoretical arrival time": each message
+ * pushes it interval ticks into the future, and a message is admitted while
+ * that stays within burst intervals of now. Equivalent to a bucket of burst
+ * tokens refilled at rate per second, but refill needs no timer and an
+ * admit is a single CAS; a reject is a plain load, so threads spinning on a
+ * full bucket do not fight over the cache line. Safe to share across any
+ * number of threads.
+ */
+class RateThrottle {
+private:
+    alignas(64) std::atomic<uint64_t> tat_{0};
+    uint64_t interval_;         // ticks per message
+    uint64_t window_;           // burst * interval_
+    double ticks_per_second_;
+
+public:
+    // rate messages per second, bursts of up to burst messages; tick rate defaults to TscClock's
+    RateThrottle(double rate, uint32_t burst, double ticks_per_second = TscClock::ticks_per_second());
+
+    // Take n tokens at tick now; false (nothing taken) if they are not available
+    bool try_acquire_at(uint64_t now, uint32_t n = 1) {
+        uint64_t cost = n * interval_;
+        uint64_t tat = tat_.load(std::memory_order_relaxed);
+        while (true) {
+            uint64_t next = (tat > now ? tat : now) + cost;
+            if (next > now + window_) {
+                return false;
+            }
+            if (tat_.compare_exchange_weak(tat, next, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+    }
+
+    bool try_acquire(uint32_t n = 1) { return try_acquire_at(TscClock::now(), n); }
+
+    // Tokens available at tick now
+    uint64_t available_at(uint64_t now) const {
+        uint64_t tat = tat_.load(std::memory_order_relaxed);
+        uint64_t used = tat > now ? tat - now : 0;
+        return (window_ - (used < window_ ? used : window_)) / interval_;
+    }
+
+    uint64_t interval() const { return interval_; }
+    double ticks_per_second() const { return ticks_per_second_; }
+};
+
+enum class OutboundKind : uint8_t { New, Amend, Cancel };
+
+// Outbound child-order message
+struct OutboundMessage {
+    uint64_t child_id;
+    OutboundKind kind;
+    int64_t price = 0;
+    uint32_t quantity = 0;
+};
+
+struct QueueStats {
+    uint64_t queued = 0;
+    uint64_t coalesced = 0;     // merged into a pending message for the same child
+    uint64_t dropped = 0;       // New + Cancel pairs that never reached the venue
+};
+
+/**
+ * FIFO of messages held back by a throttle, coalesced per child
+ *
+ * A pending message absorbs later ones for the same child in place (keeping
+ * its queue position): an amend updates a pending new or amend, a cancel
+ * replaces a pending amend and erases a pending new outright, anything after
+ * a pending cancel is dropped. Owned by one thread (typically one per
+ * strategy thread, all sharing the throttle).
+ */
+class CoalescingQueue {
+private:
+    struct Slot {
+        OutboundMessage message;
+        bool live;
+    };
+
+    std::deque<Slot> pending_;
+    FlatHashMap<uint64_t> by_child_;    // child id -> sequence number of its pending slot
+    uint64_t head_seq_ = 0;             // sequence number of pending_.front()
+    size_t live_ = 0;
+    QueueStats stats_;
+
+    void trim();
+
+public:
+    void push(const OutboundMessage& message);
+
+    // Send now if nothing is queued and a token is available, else queue; true if sent
+    template <typename Send>
+    bool submit(RateThrottle& throttle, const OutboundMessage& message, Send&& send) {
+        if (live_ == 0 && throttle.try_acquire()) {
+            send(message);
+            return true;
+        }
+        push(message);
+        return false;
+    }
+
+    // Send queued messages in order while the throttle admits them; returns the number sent
+    template <typename Send>
+    size_t drain(RateThrottle& throttle, Send&& send) {
+        size_t sent = 0;
+        while (live_ > 0 && throttle.try_acquire()) {
+            send(pending_.front().message);
+            pop();
+            ++sent;
+        }
+        return sent;
+    }
+
+    // nullptr when empty
+    const OutboundMessage* front() const { return live_ > 0 ? &pending_.front().message : nullptr; }
+    void pop();
+
+    size_t size() const { return live_; }
+    bool empty() const { return live_ == 0; }
+    const QueueStats& stats() const { return stats_; }
+};
+
+} // namespace execution
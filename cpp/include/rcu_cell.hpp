@@ -0,0 +1,211 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace execution {
+
+/**
+ * Hot-reloadable immutable value (strategy parameters, risk limits)
+ *
+ * Quiescent-state RCU: readers load the current version with one acquire
+ * load, and between two calls to quiescent() every pointer they loaded stays
+ * valid. quiescent() just copies the global epoch into the reader's own
+ * cache line - no lock, no atomic read-modify-write, no fence - so it can sit
+ * at the top of every slice decision or event batch. publish() swaps in a
+ * new version and retires the old one under the current epoch; a retired
+ * version is freed once every online reader has announced a later epoch.
+ *
+ * Going online (register_reader, online()) costs one full fence; readers
+ * that block or idle should go offline() so they do not hold up reclamation.
+ */
+template <typename T>
+class RcuCell {
+private:
+    static constexpr uint64_t OFFLINE = 0;
+
+    struct alignas(64) ReaderSlot {
+        std::atomic<uint64_t> seen{OFFLINE};   // last epoch announced
+        bool used = false;                     // guarded by mutex_
+    };
+
+    struct Retired {
+        uint64_t epoch;                        // freed once every online reader has seen it
+        const T* value;
+    };
+
+    alignas(64) std::atomic<const T*> current_;
+    alignas(64) std::atomic<uint64_t> epoch_{1};
+    std::unique_ptr<ReaderSlot[]> slots_;
+    size_t max_readers_;
+    std::mutex mutex_;                         // writers and reader registration only
+    std::vector<Retired> retired_;
+
+    // Lowest epoch announced by an online reader, UINT64_MAX if none (mutex_ held)
+    uint64_t oldest_seen() const {
+        // Pairs with the fence in Reader::online(): a reader coming online either
+        // shows up here or loads the version already published
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        uint64_t oldest = UINT64_MAX;
+        for (size_t i = 0; i < max_readers_; ++i) {
+            uint64_t seen = slots_[i].seen.load(std::memory_order_acquire);
+            if (seen != OFFLINE && seen < oldest) {
+                oldest = seen;
+            }
+        }
+        return oldest;
+    }
+
+    size_t reclaim_locked() {
+        uint64_t oldest = oldest_seen();
+        size_t freed = 0;
+        size_t kept = 0;
+        for (Retired& r : retired_) {
+            if (r.epoch <= oldest) {
+                delete r.value;
+                ++freed;
+            } else {
+                retired_[kept++] = r;
+            }
+        }
+        retired_.resize(kept);
+        return freed;
+    }
+
+public:
+    /**
+     * One reader thread's handle; move-only, goes offline and frees its slot
+     * when destroyed. Not thread-safe itself: one handle per thread.
+     */
+    class Reader {
+    private:
+        RcuCell* cell_;
+        size_t slot_;
+
+        std::atomic<uint64_t>& seen() const { return cell_->slots_[slot_].seen; }
+
+    public:
+        Reader(RcuCell* cell, size_t slot) : cell_(cell), slot_(slot) {}
+
+        Reader(Reader&& other) noexcept : cell_(other.cell_), slot_(other.slot_) { other.cell_ = nullptr; }
+        Reader& operator=(Reader&&) = delete;
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        ~Reader() {
+            if (cell_ != nullptr) {
+                offline();
+                std::lock_guard<std::mutex> lock(cell_->mutex_);
+                cell_->slots_[slot_].used = false;
+            }
+        }
+
+        // Current version; valid until this reader's next quiescent() / offline()
+        const T* get() const { return cell_->current_.load(std::memory_order_acquire); }
+        const T& operator*() const { return *get(); }
+        const T* operator->() const { return get(); }
+
+        // Drop every pointer obtained so far
+        void quiescent() {
+            seen().store(cell_->epoch_.load(std::memory_order_acquire), std::memory_order_release);
+        }
+
+        void offline() { seen().store(OFFLINE, std::memory_order_release); }
+
+        void online() {
+            seen().store(cell_->epoch_.load(std::memory_order_acquire), std::memory_order_relaxed);
+            // The announcement must be visible before this reader loads current_
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+    };
+
+    explicit RcuCell(std::unique_ptr<const T> initial, size_t max_readers = 64)
+        : current_(initial.release()), slots_(new ReaderSlot[max_readers]), max_readers_(max_readers) {
+        if (current_.load() == nullptr || max_readers == 0) {
+            delete current_.load();
+            throw std::invalid_argument("rcu cell needs an initial value and at least one reader slot");
+        }
+    }
+
+    ~RcuCell() {
+        for (Retired& r : retired_) {
+            delete r.value;
+        }
+        delete current_.load();
+    }
+
+    RcuCell(const RcuCell&) = delete;
+    RcuCell& operator=(const RcuCell&) = delete;
+
+    // Online reader handle; throws std::runtime_error when all slots are taken
+    Reader register_reader() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t i = 0; i < max_readers_; ++i) {
+            if (!slots_[i].used) {
+                slots_[i].used = true;
+                Reader reader(this, i);
+                reader.online();
+                return reader;
+            }
+        }
+        throw std::runtime_error("rcu cell: no free reader slot");
+    }
+
+    // Writer-side snapshot (also fine from a reader between quiescent points)
+    const T* get() const { return current_.load(std::memory_order_acquire); }
+
+    /**
+     * Make next the current version. The old one is freed by this or a later
+     * publish / reclaim once readers have moved past it; returns the new
+     * version number.
+     */
+    uint64_t publish(std::unique_ptr<const T> next) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const T* old = current_.exchange(next.release(), std::memory_order_acq_rel);
+        uint64_t epoch = epoch_.fetch_add(1, std::memory_order_acq_rel) + 1;
+        retired_.push_back(Retired{epoch, old});
+        reclaim_locked();
+        return epoch;
+    }
+
+    template <typename... Args>
+    uint64_t emplace(Args&&... args) {
+        return publish(std::make_unique<const T>(std::forward<Args>(args)...));
+    }
+
+    // Free what no reader can still hold; returns the number of versions freed
+    size_t reclaim() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return reclaim_locked();
+    }
+
+    // Wait out a full grace period: return once every retired version is freed
+    void synchronize() {
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                reclaim_locked();
+                if (retired_.empty()) {
+                    return;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    uint64_t version() const { return epoch_.load(std::memory_order_acquire); }
+
+    size_t pending() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return retired_.size();
+    }
+};
+
+} // namespace execution
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <order.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace execution {
+
+struct RegimeConfig {
+    size_t vol_window = 20;             // days of log returns in rolling volatility
+    size_t volume_window = 20;          // short volume average
+    size_t volume_baseline = 250;       // long volume average (regime = short / long)
+    size_t num_vol_buckets = 3;         // volatility quantile buckets
+    size_t num_volume_buckets = 3;      // volume quantile buckets
+    size_t num_threads = 0;             // 0 = hardware concurrency
+};
+
+// Strategy metrics for one (vol bucket, volume bucket) cell
+struct RegimeBucket {
+    size_t vol_bucket;
+    size_t volume_bucket;
+    uint64_t count;
+
+    double twap_mean_bps;
+    double twap_std_bps;
+    double twap_p5_bps;
+    double twap_p95_bps;
+
+    double vwap_mean_bps;
+    double vwap_std_bps;
+    double vwap_p5_bps;
+    double vwap_p95_bps;
+
+    RegimeBucket()
+        : vol_bucket(0), volume_bucket(0), count(0),
+          twap_mean_bps(0.0), twap_std_bps(0.0), twap_p5_bps(0.0), twap_p95_bps(0.0),
+          vwap_mean_bps(0.0), vwap_std_bps(0.0), vwap_p5_bps(0.0), vwap_p95_bps(0.0) {}
+};
+
+struct RegimeReport {
+    std::vector<RegimeBucket> buckets;      // row-major: vol_bucket * num_volume_buckets + volume_bucket
+    std::vector<double> vol_edges;          // inner quantile cut points
+    std::vector<double> volume_edges;
+    std::vector<int> vol_labels;            // per start index, -1 = not enough history
+    std::vector<int> volume_labels;
+    uint64_t num_skipped;                   // start indices without a label
+};
+
+// Stdev of daily log returns over the trailing window ending at i (NaN before
+// enough history and while the window holds a zero / non-finite price)
+std::vector<double> rolling_volatility(const std::vector<double>& prices, size_t window);
+
+// Short / long trailing average volume, NaN when the baseline has no volume (pre-1950 rows)
+std::vector<double> relative_volume(const std::vector<double>& volumes, size_t window, size_t baseline);
+
+// Quantile bucket of each value, -1 for NaN; edges are cut over all of values (in-sample)
+std::vector<int> quantile_labels(const std::vector<double>& values, size_t num_buckets, std::vector<double>& edges);
+
+/**
+ * Label every start index by volatility / volume regime and aggregate TWAP vs VWAP
+ * slippage per bucket in one parallel pass over the history
+ * The regime features (rolling volatility, relative volume) are trailing, but
+ * the bucket edges are quantiles of the whole history, so labels are
+ * in-sample: fine for describing regimes, not for a live signal
+ */
+RegimeReport regime_backtest(
+    const std::vector<double>& prices,
+    const std::vector<double>& volumes,
+    const Order& order,
+    const RegimeConfig& config = RegimeConfig()
+);
+
+} // namespace execution
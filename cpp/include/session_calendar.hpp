@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace execution {
+
+// One trading session; minutes are minutes after midnight, exchange time
+struct Session {
+    int32_t date;               // yyyymmdd
+    uint16_t open_minute;
+    uint16_t close_minute;
+
+    uint32_t minutes() const { return close_minute - open_minute; }
+};
+
+/**
+ * Trading days with their open / close times
+ *
+ * Built once (from weekdays minus holidays, or from explicit sessions) and
+ * shared: prefix sums of session minutes make "minutes between two sessions"
+ * a subtraction, so schedule generation never walks the calendar per order.
+ */
+class SessionCalendar {
+private:
+    std::vector<Session> sessions_;
+    std::vector<uint64_t> minute_offsets_;  // minutes before each session, plus total
+
+public:
+    SessionCalendar() = default;
+
+    // Sessions in strictly increasing date order with open < close
+    explicit SessionCalendar(std::vector<Session> sessions);
+
+    /**
+     * Monday-Friday in [first_date, last_date] (yyyymmdd) except holidays;
+     * half_days close at half_day_close. Defaults: 09:30 - 16:00, 13:00 half-days.
+     */
+    static SessionCalendar weekdays(int32_t first_date, int32_t last_date,
+                                    const std::vector<int32_t>& holidays = {},
+                                    const std::vector<int32_t>& half_days = {},
+                                    uint16_t open_minute = 570, uint16_t close_minute = 960,
+                                    uint16_t half_day_close = 780);
+
+    // First session on or after date (size() if none)
+    size_t index_of(int32_t date) const;
+
+    // Trading minutes in sessions [first, last)
+    uint64_t minutes_between(size_t first, size_t last) const {
+        return minute_offsets_[last] - minute_offsets_[first];
+    }
+
+    const Session& operator[](size_t i) const { return sessions_[i]; }
+    const std::vector<Session>& sessions() const { return sessions_; }
+    size_t size() const { return sessions_.size(); }
+};
+
+// Days since 1970-01-01 of a yyyymmdd date (proleptic Gregorian)
+int64_t days_from_civil(int32_t date);
+
+// Day of week of a yyyymmdd date, 0 = Monday
+int day_of_week(int32_t date);
+
+enum class SessionBudget : uint8_t {
+    ByMinutes,                  // each session's share follows its trading minutes (half-days get less)
+    Equal,                      // same quantity every session
+};
+
+// Parent order spanning num_sessions sessions from the first session on or after start_date
+struct MultiDayOrder {
+    int32_t start_date;
+    uint32_t num_sessions;
+    double quantity;
+    uint16_t start_minute = 0;  // intraday start on the first session (0 = at the open)
+};
+
+struct ScheduleConfig {
+    uint32_t slice_minutes = 30;        // one slice per interval; sessions always get at least one
+    SessionBudget budget = SessionBudget::ByMinutes;
+    size_t num_threads = 0;
+};
+
+/**
+ * Slices of many orders, order-major and columnar
+ *
+ * Slices never straddle a close: each session restarts at its open, so the
+ * overnight gap falls between two slices, never inside one.
+ */
+struct Schedule {
+    std::vector<uint32_t> session;      // calendar index
+    std::vector<uint16_t> minute;       // slice start, minutes after midnight
+    std::vector<double> quantity;
+    std::vector<size_t> order_offsets;  // first slice of each order, plus total
+
+    size_t size() const { return quantity.size(); }
+    size_t num_orders() const { return order_offsets.empty() ? 0 : order_offsets.size() - 1; }
+};
+
+/**
+ * Schedules for all orders in one pass: slice counts come from per-session
+ * prefix sums, offsets from a scan, and the slices are written in parallel
+ * straight into their final positions. An order whose sessions run past the
+ * calendar is cut at its end.
+ */
+Schedule build_schedules(const SessionCalendar& calendar, const std::vector<MultiDayOrder>& orders,
+                         const ScheduleConfig& config = ScheduleConfig());
+
+} // namespace execution
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace execution {
+
+struct SweepConfig {
+    std::vector<size_t> slice_counts = {5, 10, 20, 50};
+    std::string direction = "buy";
+    size_t block_size = 1024;           // start indices per tile; 0 = no tiling (each slice count streams the range)
+    size_t num_threads = 0;             // 0 = hardware concurrency
+};
+
+/**
+ * TWAP / VWAP slippage (bps vs the start price) for every (slice count, start index)
+ * Row-major [slice count][start]; NaN where the window runs past the data
+ */
+struct SweepGrid {
+    std::vector<size_t> slice_counts;
+    size_t num_starts = 0;
+    std::vector<double> twap_bps;
+    std::vector<double> vwap_bps;
+
+    double twap(size_t k, size_t start) const { return twap_bps[k * num_starts + start]; }
+    double vwap(size_t k, size_t start) const { return vwap_bps[k * num_starts + start]; }
+};
+
+// Per slice count summary over all start indices
+struct SliceStats {
+    size_t num_slices = 0;
+    uint64_t count = 0;
+    double twap_mean_bps = 0.0;
+    double twap_std_bps = 0.0;
+    double vwap_mean_bps = 0.0;
+    double vwap_std_bps = 0.0;
+};
+
+/**
+ * Cache-blocked sweep: start indices are cut into tiles of block_size, and
+ * every slice count is evaluated on a tile before moving to the next, so the
+ * tile's prices / volumes (block_size + max slice count rows) are read from
+ * memory once and reused from L1/L2 for every slice count. Within a tile each
+ * slice count slides its window sums (re-seeded per tile and every few
+ * thousand starts, which bounds rounding drift), so a pair costs O(1); results
+ * are produced in short L1-resident row chunks. Tiles run in parallel.
+ *
+ * Matches twap_avg_price / vwap_avg_price up to rounding (non-positive and
+ * NaN volumes count as no volume; a window without volume falls back to TWAP).
+ * Prices must be finite and volumes not infinite: a running sum would carry
+ * one bad value into every later window, so such input throws.
+ */
+SweepGrid sweep_slices(const std::vector<double>& prices, const std::vector<double>& volumes,
+                       const SweepConfig& config = SweepConfig());
+
+// Same traversal reduced to mean / std per slice count (no grid is materialized)
+std::vector<SliceStats> sweep_slice_stats(const std::vector<double>& prices, const std::vector<double>& volumes,
+                                          const SweepConfig& config = SweepConfig());
+
+} // namespace execution
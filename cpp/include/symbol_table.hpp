@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace execution {
+
+/**
+ * Ticker -> dense id interner with a minimal perfect hash for ingress
+ *
+ * At load time intern() hands out ids 0, 1, 2... in order of first
+ * appearance, so engine state can live in plain arrays indexed by id. build()
+ * then freezes the set into a CHD (compress, hash and displace) minimal
+ * perfect hash: keys hash into ~n/4 buckets, each bucket stores the one small
+ * displacement that sends all its keys to distinct slots of an n-slot table.
+ * A lookup is one string hash, two array reads and one string compare, with
+ * no probing; the tables take ~5 bytes per symbol.
+ */
+class SymbolTable {
+private:
+    std::vector<std::string> names_;                    // id -> ticker
+    std::unordered_map<std::string, uint32_t> loading_; // load-time index
+    std::vector<uint32_t> displacement_;                // per bucket
+    std::vector<uint32_t> slot_ids_;                    // slot -> id
+    uint64_t seed_ = 0;
+    bool built_ = false;
+
+    static uint64_t hash(std::string_view s, uint64_t seed);
+    uint32_t slot_of(uint64_t h, uint32_t d) const;
+
+public:
+    static constexpr uint32_t NOT_FOUND = UINT32_MAX;
+
+    SymbolTable() = default;
+
+    // Interns every ticker in order, then builds
+    explicit SymbolTable(const std::vector<std::string>& tickers);
+
+    // Id of symbol, assigning the next one if new (invalidates the perfect hash until build())
+    uint32_t intern(std::string_view symbol);
+
+    // Freeze the current symbols into the perfect hash
+    void build();
+
+    // Id of symbol or NOT_FOUND; falls back to the load-time index before build()
+    uint32_t find(std::string_view symbol) const;
+
+    // ITCH stock field: 8 bytes, left-justified, space padded
+    uint32_t find_itch(const char (&stock)[8]) const;
+
+    const std::string& name(uint32_t id) const { return names_.at(id); }
+    const std::vector<std::string>& names() const { return names_; }
+    size_t size() const { return names_.size(); }
+    size_t num_buckets() const { return displacement_.size(); }
+    bool built() const { return built_; }
+};
+
+} // namespace execution
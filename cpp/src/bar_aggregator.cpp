@@ -0,0 +1,162 @@
+#include "bar_aggregator.hpp"
+
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace execution {
+
+namespace {
+
+// Floor division so negative timestamps still align on the grid
+inline int64_t bucket_start(int64_t ts, int64_t interval) {
+    int64_t q = ts / interval;
+    if (ts % interval != 0 && ts < 0) {
+        --q;
+    }
+    return q * interval;
+}
+
+void check_columns(const TickData& ticks) {
+    if (ticks.timestamps.size() != ticks.count() || ticks.size.size() != ticks.count()) {
+        throw std::invalid_argument("tick columns must have the same length");
+    }
+}
+
+} // namespace
+
+BarAggregator::BarAggregator(std::vector<BarSpec> specs)
+    : specs_(std::move(specs)), intervals_(specs_.size(), 0), open_(specs_.size()), bars_(specs_.size()) {
+    if (specs_.empty()) {
+        throw std::invalid_argument("at least one bar spec is required");
+    }
+    for (size_t s = 0; s < specs_.size(); ++s) {
+        if (!std::isfinite(specs_[s].threshold) || !(specs_[s].threshold > 0.0)) {
+            throw std::invalid_argument("bar threshold must be positive and finite");
+        }
+        if (specs_[s].kind == BarKind::Time) {
+            // 2^63: the first double that does not fit in int64_t
+            if (specs_[s].threshold >= 9223372036854775808.0) {
+                throw std::invalid_argument("time bar interval does not fit in int64 ns");
+            }
+            intervals_[s] = static_cast<int64_t>(specs_[s].threshold);
+            if (intervals_[s] <= 0) {
+                throw std::invalid_argument("time bar interval must be at least 1 ns");
+            }
+        }
+    }
+}
+
+void BarAggregator::reserve(size_t bars_per_spec) {
+    for (MarketData& md : bars_) {
+        md.reserve(bars_per_spec);
+    }
+}
+
+void BarAggregator::reserve(size_t s, size_t num_bars) {
+    bars_.at(s).reserve(num_bars);
+}
+
+void BarAggregator::close_bar(size_t s) {
+    OpenBar& bar = open_[s];
+    bars_[s].push_back(bar.start, bar.open, bar.high, bar.low, bar.close, bar.volume);
+    bar.active = false;
+}
+
+void BarAggregator::on_tick(int64_t timestamp, double price, double size) {
+    if (!std::isfinite(price) || !std::isfinite(size) || !(size > 0.0)) {
+        ++num_skipped_;
+        return;
+    }
+    ++num_ticks_;
+    double notional = price * size;
+
+    for (size_t s = 0; s < specs_.size(); ++s) {
+        OpenBar& bar = open_[s];
+        BarKind kind = specs_[s].kind;
+
+        // a time bar closes on the first tick past its bucket (late ticks stay in the open bar)
+        if (kind == BarKind::Time && bar.active) {
+            int64_t start = bucket_start(timestamp, intervals_[s]);
+            if (start > bar.start) {
+                close_bar(s);
+            }
+        }
+
+        if (!bar.active) {
+            bar.start = kind == BarKind::Time ? bucket_start(timestamp, intervals_[s]) : timestamp;
+            bar.open = bar.high = bar.low = price;
+            bar.volume = 0.0;
+            bar.accumulated = 0.0;
+            bar.active = true;
+        } else {
+            bar.high = price > bar.high ? price : bar.high;
+            bar.low = price < bar.low ? price : bar.low;
+        }
+        bar.close = price;
+        bar.volume += size;
+
+        if (kind != BarKind::Time) {
+            bar.accumulated += kind == BarKind::Volume ? size : notional;
+            if (bar.accumulated >= specs_[s].threshold) {
+                close_bar(s);
+            }
+        }
+    }
+}
+
+void BarAggregator::on_ticks(const int64_t* timestamps, const double* price, const double* size, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        on_tick(timestamps[i], price[i], size[i]);
+    }
+}
+
+void BarAggregator::on_ticks(const TickData& ticks) {
+    check_columns(ticks);
+    on_ticks(ticks.timestamps.data(), ticks.price.data(), ticks.size.data(), ticks.count());
+}
+
+void BarAggregator::flush() {
+    for (size_t s = 0; s < specs_.size(); ++s) {
+        if (open_[s].active) {
+            close_bar(s);
+        }
+    }
+}
+
+void BarAggregator::clear_bars() {
+    for (MarketData& md : bars_) {
+        md.clear();
+    }
+}
+
+std::vector<MarketData> BarAggregator::release_bars() {
+    std::vector<MarketData> result(bars_.size());
+    result.swap(bars_);
+    return result;
+}
+
+std::vector<MarketData> aggregate_bars(const TickData& ticks, const std::vector<BarSpec>& specs) {
+    BarAggregator aggregator(specs);
+    check_columns(ticks);
+
+    // upper bound for volume / dollar bars is one per tick; time bars by span
+    if (ticks.count() > 0) {
+        int64_t span = ticks.timestamps.back() - ticks.timestamps.front();
+        for (size_t s = 0; s < aggregator.num_specs(); ++s) {
+            const BarSpec& spec = aggregator.spec(s);
+            size_t n = ticks.count();
+            if (spec.kind == BarKind::Time && span >= 0) {
+                double buckets = static_cast<double>(span) / spec.threshold + 2.0;
+                n = buckets < static_cast<double>(n) ? static_cast<size_t>(buckets) : n;
+            }
+            aggregator.reserve(s, n);
+        }
+    }
+
+    aggregator.on_ticks(ticks);
+    aggregator.flush();
+    return aggregator.release_bars();
+}
+
+} // namespace execution
@@ -0,0 +1,95 @@
+#include "child_orders.hpp"
+
+#include <algorithm>
+
+namespace execution {
+
+ChildOrderStore::ChildOrderStore(size_t max_orders, size_t max_fills, size_t max_levels, size_t max_parents)
+    : orders_(max_orders), fills_(max_fills), by_id_(max_orders), levels_(max_levels), parents_(max_parents) {}
+
+void ChildOrderStore::join_level(ChildOrder& order) {
+    LevelQueue* queue = levels_.insert(level_key(order.side, order.price), LevelQueue()).first;
+    queue->push_back(order);
+}
+
+void ChildOrderStore::leave_level(ChildOrder& order) {
+    if (!order.level_hook.linked) {
+        return;
+    }
+    uint64_t key = level_key(order.side, order.price);
+    LevelQueue* queue = levels_.find(key);
+    queue->remove(order);
+    if (queue->empty()) {
+        levels_.erase(key);
+    }
+}
+
+ChildOrder* ChildOrderStore::create(uint64_t parent_id, Side side, int64_t price, uint32_t quantity) {
+    ChildOrder* order = orders_.allocate(next_id_, parent_id, side, price, quantity);
+    if (order == nullptr) {
+        return nullptr;
+    }
+    ++next_id_;
+    by_id_.insert(order->id, order);
+    join_level(*order);
+    parents_.insert(parent_id, ChildList()).first->push_back(*order);
+    return order;
+}
+
+bool ChildOrderStore::amend(ChildOrder& order, int64_t price, uint32_t quantity) {
+    if (!order.working || quantity <= order.filled) {
+        return false;
+    }
+    bool requeue = price != order.price || quantity > order.quantity;
+    if (requeue) {
+        leave_level(order);
+        order.price = price;
+    }
+    order.quantity = quantity;
+    if (requeue) {
+        join_level(order);
+    }
+    return true;
+}
+
+ChildFill* ChildOrderStore::fill(ChildOrder& order, uint32_t quantity, int64_t price, uint64_t timestamp) {
+    quantity = std::min(quantity, order.remaining());
+    if (quantity == 0) {
+        return nullptr;
+    }
+    order.filled += quantity;
+    if (order.remaining() == 0) {
+        cancel(order);
+    }
+    ChildFill* record = fills_.allocate(order.id, timestamp, price, quantity);
+    if (record != nullptr) {
+        order.fills.push_back(*record);
+    }
+    return record;
+}
+
+void ChildOrderStore::cancel(ChildOrder& order) {
+    leave_level(order);
+    order.working = false;
+}
+
+void ChildOrderStore::release(ChildOrder& order) {
+    leave_level(order);
+    while (ChildFill* f = order.fills.pop_front()) {
+        fills_.release(f);
+    }
+    ChildList* siblings = parents_.find(order.parent_id);
+    siblings->remove(order);
+    if (siblings->empty()) {
+        parents_.erase(order.parent_id);
+    }
+    by_id_.erase(order.id);
+    orders_.release(&order);
+}
+
+ChildOrder* ChildOrderStore::find(uint64_t id) {
+    ChildOrder** order = by_id_.find(id);
+    return order == nullptr ? nullptr : *order;
+}
+
+} // namespace execution
@@ -0,0 +1,264 @@
+#include "data_loader.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+
+namespace execution {
+
+namespace {
+
+constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+/**
+ * Row-at-a-time cleaning shared by the CSV reader and in-memory bars, so a
+ * load validates, fills and builds the mask in the same pass as parsing
+ */
+class Cleaner {
+private:
+    const CleanConfig& config_;
+    CleanData out_;
+    double last_price_[4] = {NaN, NaN, NaN, NaN};
+    double last_volume_ = NaN;
+    bool traded_yet_ = false;
+
+    // false when the row has to be dropped
+    static bool fill(double& x, double last, NanPolicy policy) {
+        switch (policy) {
+        case NanPolicy::Keep:
+            return true;
+        case NanPolicy::Zero:
+            x = 0.0;
+            return true;
+        case NanPolicy::ForwardFill:
+            x = last;
+            return !std::isnan(last);
+        default:
+            return false;
+        }
+    }
+
+public:
+    Cleaner(const CleanConfig& config, size_t expected_rows) : config_(config) {
+        out_.bars.reserve(expected_rows);
+        out_.config = config;
+    }
+
+    void add(int64_t ts, double open, double high, double low, double close, double volume) {
+        CleanReport& report = out_.report;
+        ++report.rows;
+
+        double px[4] = {open, high, low, close};
+        bool keep = true;
+        for (int k = 0; k < 4; ++k) {
+            if (std::isnan(px[k])) {
+                ++report.nan_prices;
+                keep &= fill(px[k], last_price_[k], config_.price_nan);
+            }
+        }
+        bool valid_volume = std::isfinite(volume) && volume >= 0.0;
+        if (!valid_volume) {
+            ++report.nan_volumes;
+            keep &= fill(volume, last_volume_, config_.volume_nan);
+        }
+        if (!keep) {
+            ++report.dropped_rows;
+            return;
+        }
+
+        MarketData& bars = out_.bars;
+        if (config_.require_increasing_dates && !bars.empty() && ts <= bars.timestamps.back()) {
+            throw std::invalid_argument("timestamps must be strictly increasing (row " + std::to_string(report.rows) + ")");
+        }
+        for (int k = 0; k < 4; ++k) {
+            if (!std::isnan(px[k])) {
+                last_price_[k] = px[k];
+            }
+        }
+        if (valid_volume) {
+            last_volume_ = volume;
+        }
+
+        bool traded = volume > 0.0;
+        if (!traded) {
+            ++report.zero_volume_rows;
+        } else if (!traded_yet_) {
+            report.first_traded = bars.size();
+            traded_yet_ = true;
+        }
+        out_.has_volume.push_back(traded);
+        bars.push_back(ts, px[0], px[1], px[2], px[3], volume);
+    }
+
+    CleanData finish() {
+        if (!traded_yet_) {
+            out_.report.first_traded = out_.bars.size();
+        }
+        return std::move(out_);
+    }
+};
+
+std::string_view trim(std::string_view s) {
+    while (!s.empty() && (s.front() == ' ' || s.front() == '"')) {
+        s.remove_prefix(1);
+    }
+    while (!s.empty() && (s.back() == ' ' || s.back() == '"' || s.back() == '\r')) {
+        s.remove_suffix(1);
+    }
+    return s;
+}
+
+// Empty / unparsable ("null", "NaN", ...) fields are missing
+double parse_number(std::string_view s) {
+    s = trim(s);
+    double x = NaN;
+    auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), x);
+    if (s.empty() || ec != std::errc() || ptr != s.data() + s.size()) {
+        return NaN;
+    }
+    return x;
+}
+
+bool parse_int(std::string_view s, int& out) {
+    auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), out);
+    return !s.empty() && ec == std::errc() && ptr == s.data() + s.size();
+}
+
+// M/D/YYYY or YYYY-MM-DD to yyyymmdd, -1 if malformed
+int64_t parse_date(std::string_view s) {
+    s = trim(s);
+    char sep = s.find('/') != std::string_view::npos ? '/' : '-';
+    size_t a = s.find(sep);
+    size_t b = a == std::string_view::npos ? a : s.find(sep, a + 1);
+    if (b == std::string_view::npos) {
+        return -1;
+    }
+    int x, y, z;
+    if (!parse_int(s.substr(0, a), x) || !parse_int(s.substr(a + 1, b - a - 1), y) || !parse_int(s.substr(b + 1), z)) {
+        return -1;
+    }
+    int year = sep == '/' ? z : x;
+    int month = sep == '/' ? x : y;
+    int day = sep == '/' ? y : z;
+    if (month < 1 || month > 12 || day < 1 || day > 31) {
+        return -1;
+    }
+    return int64_t{year} * 10000 + month * 100 + day;
+}
+
+void split(std::string_view line, std::vector<std::string_view>& fields) {
+    fields.clear();
+    size_t start = 0;
+    for (size_t i = 0; i <= line.size(); ++i) {
+        if (i == line.size() || line[i] == ',') {
+            fields.push_back(line.substr(start, i - start));
+            start = i + 1;
+        }
+    }
+}
+
+} // namespace
+
+size_t BitMask::count(size_t begin, size_t end) const {
+    if (end > size_) {
+        throw std::out_of_range("mask range runs past the end");
+    }
+    if (begin >= end) {
+        return 0;
+    }
+    size_t first = begin / 64;
+    size_t last = (end - 1) / 64;
+    uint64_t head = ~uint64_t{0} << (begin % 64);
+    uint64_t tail = ~uint64_t{0} >> (63 - (end - 1) % 64);
+    if (first == last) {
+        return std::popcount(words_[first] & head & tail);
+    }
+    size_t total = std::popcount(words_[first] & head) + std::popcount(words_[last] & tail);
+    for (size_t w = first + 1; w < last; ++w) {
+        total += std::popcount(words_[w]);
+    }
+    return total;
+}
+
+CleanData clean_market_data(const MarketData& bars, const CleanConfig& config) {
+    size_t n = bars.size();
+    if (bars.timestamps.size() != n || bars.open.size() != n || bars.high.size() != n ||
+        bars.low.size() != n || bars.volume.size() != n) {
+        throw std::invalid_argument("columns must have the same length");
+    }
+    Cleaner cleaner(config, n);
+    for (size_t i = 0; i < n; ++i) {
+        cleaner.add(bars.timestamps[i], bars.open[i], bars.high[i], bars.low[i], bars.close[i], bars.volume[i]);
+    }
+    return cleaner.finish();
+}
+
+CleanData parse_market_data(const std::string& csv, const CleanConfig& config) {
+    std::string_view text(csv);
+    size_t line_end = text.find('\n');
+    std::vector<std::string_view> fields;
+    split(text.substr(0, line_end), fields);
+
+    // Column index per field, by header name
+    const char* names[6] = {"Date", "Open", "High", "Low", "Close", "Volume"};
+    size_t column[6];
+    size_t min_fields = 0;
+    for (int k = 0; k < 6; ++k) {
+        column[k] = SIZE_MAX;
+        for (size_t f = 0; f < fields.size(); ++f) {
+            if (trim(fields[f]) == names[k]) {
+                column[k] = f;
+            }
+        }
+        if (column[k] == SIZE_MAX) {
+            throw std::runtime_error(std::string("missing column: ") + names[k]);
+        }
+        min_fields = std::max(min_fields, column[k] + 1);
+    }
+
+    size_t expected_rows = 0;
+    for (char c : text) {
+        expected_rows += c == '\n';
+    }
+    Cleaner cleaner(config, expected_rows);
+
+    size_t line_no = 1;
+    while (line_end != std::string_view::npos) {
+        size_t start = line_end + 1;
+        line_end = text.find('\n', start);
+        std::string_view line = text.substr(start, line_end == std::string_view::npos ? line_end : line_end - start);
+        ++line_no;
+        if (trim(line).empty()) {
+            continue;
+        }
+        split(line, fields);
+        if (fields.size() < min_fields) {
+            throw std::runtime_error("short row at line " + std::to_string(line_no));
+        }
+        int64_t date = parse_date(fields[column[0]]);
+        if (date < 0) {
+            throw std::runtime_error("bad date at line " + std::to_string(line_no));
+        }
+        cleaner.add(date, parse_number(fields[column[1]]), parse_number(fields[column[2]]),
+                    parse_number(fields[column[3]]), parse_number(fields[column[4]]), parse_number(fields[column[5]]));
+    }
+    return cleaner.finish();
+}
+
+CleanData load_market_data(const std::string& path, const CleanConfig& config) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("cannot open data file: " + path);
+    }
+    std::ostringstream text;
+    text << file.rdbuf();
+    return parse_market_data(text.str(), config);
+}
+
+} // namespace execution
@@ -0,0 +1,180 @@
+#include "dp_solver.hpp"
+#include "parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+namespace execution {
+
+namespace {
+
+constexpr double INF = std::numeric_limits<double>::infinity();
+
+void validate(const DPConfig& config, const DPCostModel& model) {
+    if (config.num_steps == 0 || config.num_lots == 0 || !(config.lot_size > 0.0) || !std::isfinite(config.lot_size)) {
+        throw std::invalid_argument("need num_steps > 0, num_lots > 0, finite lot_size > 0");
+    }
+    if (config.num_lots > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+        throw std::invalid_argument("num_lots too large");
+    }
+    if (!config.volume_profile.empty()) {
+        if (config.volume_profile.size() != config.num_steps) {
+            throw std::invalid_argument("volume_profile must have num_steps entries");
+        }
+        for (double v : config.volume_profile) {
+            if (!(v > 0.0)) {
+                throw std::invalid_argument("volume_profile must be positive");
+            }
+        }
+    }
+    // NaN fails every comparison in convex(), so it would otherwise pick the exhaustive path
+    for (double p : {model.eta, model.beta, model.fixed_cost, model.risk_aversion, model.sigma}) {
+        if (!std::isfinite(p)) {
+            throw std::invalid_argument("cost model parameters must be finite");
+        }
+    }
+}
+
+// Convex case: slopes of both sequences are sorted, merging them walks the optimal split
+void convex_stage(const std::vector<double>& c, const std::vector<double>& g, size_t num_lots,
+                  std::vector<double>& value, int32_t* trade) {
+    size_t i = 0;   // lots traded now
+    size_t j = 0;   // lots carried
+    value[0] = c[0] + g[0];
+    trade[0] = 0;
+    for (size_t q = 1; q <= num_lots; ++q) {
+        double dc = c[i + 1] - c[i];
+        double dg = g[j + 1] - g[j];
+        if (dc <= dg) {
+            ++i;
+        } else {
+            ++j;
+        }
+        value[q] = c[i] + g[j];
+        trade[q] = static_cast<int32_t>(i);
+    }
+}
+
+// General case: min over r of c[q - r] + g[r], c reversed so both reads are unit-stride
+void exhaustive_stage(const std::vector<double>& c_rev, const std::vector<double>& g, size_t num_lots,
+                      WorkerPool& pool, std::vector<double>& value, int32_t* trade) {
+    pool.run(num_lots + 1, [&](size_t, size_t begin, size_t end) {
+        for (size_t q = begin; q < end; ++q) {
+            const double* cr = c_rev.data() + (num_lots - q);     // cr[r] = c[q - r]
+            const double* gr = g.data();
+            size_t len = q + 1;
+
+            // 4 independent accumulators: no loop-carried dependency, vectorizes cleanly
+            double m0 = INF, m1 = INF, m2 = INF, m3 = INF;
+            size_t r = 0;
+            for (; r + 4 <= len; r += 4) {
+                m0 = std::min(m0, cr[r] + gr[r]);
+                m1 = std::min(m1, cr[r + 1] + gr[r + 1]);
+                m2 = std::min(m2, cr[r + 2] + gr[r + 2]);
+                m3 = std::min(m3, cr[r + 3] + gr[r + 3]);
+            }
+            for (; r < len; ++r) {
+                m0 = std::min(m0, cr[r] + gr[r]);
+            }
+            double best = std::min(std::min(m0, m1), std::min(m2, m3));
+
+            // second pass for the argmin, prefer carrying the most (earliest r last)
+            size_t best_r = 0;
+            for (size_t k = len; k-- > 0;) {
+                if (cr[k] + gr[k] == best) {
+                    best_r = k;
+                    break;
+                }
+            }
+            value[q] = best;
+            trade[q] = static_cast<int32_t>(q - best_r);
+        }
+    });
+}
+
+DPSchedule solve(const DPConfig& config, const DPCostModel& model, bool use_convex) {
+    validate(config, model);
+
+    size_t steps = config.num_steps;
+    size_t lots = config.num_lots;
+    size_t width = lots + 1;
+
+    // Shared tables: impact base eta * s^(1 + beta), rescaled by V_t^-beta per step
+    std::vector<double> impact(width);
+    std::vector<double> holding(width);
+    double risk = model.risk_aversion * model.sigma * model.sigma;
+    for (size_t x = 0; x < width; ++x) {
+        double s = x * config.lot_size;
+        impact[x] = model.eta * s * std::pow(s, model.beta);
+        holding[x] = risk * s * s;
+    }
+    impact[0] = 0.0;
+
+    std::vector<int32_t> trades(steps * width);
+    std::vector<double> value(width);
+    std::vector<double> next(width);
+    std::vector<double> cost(width);
+    std::vector<double> cost_rev(use_convex ? 0 : width);
+    std::vector<double> carry(width);
+
+    // Exhaustive stages run back to back: start the threads once, not once per stage
+    WorkerPool pool(use_convex ? 1 : std::min(resolve_num_threads(config.num_threads), width));
+
+    auto stage_cost = [&](size_t t) {
+        double scale = config.volume_profile.empty() ? 1.0 : std::pow(config.volume_profile[t], -model.beta);
+        cost[0] = 0.0;
+        for (size_t x = 1; x < width; ++x) {
+            cost[x] = model.fixed_cost + impact[x] * scale;
+        }
+    };
+
+    // Last step: everything left must go
+    stage_cost(steps - 1);
+    for (size_t q = 0; q < width; ++q) {
+        next[q] = cost[q];
+        trades[(steps - 1) * width + q] = static_cast<int32_t>(q);
+    }
+
+    for (size_t t = steps - 1; t-- > 0;) {
+        stage_cost(t);
+        for (size_t r = 0; r < width; ++r) {
+            carry[r] = holding[r] + next[r];
+        }
+
+        int32_t* trade = trades.data() + t * width;
+        if (use_convex) {
+            convex_stage(cost, carry, lots, value, trade);
+        } else {
+            std::reverse_copy(cost.begin(), cost.end(), cost_rev.begin());
+            exhaustive_stage(cost_rev, carry, lots, pool, value, trade);
+        }
+        std::swap(value, next);
+    }
+
+    DPSchedule schedule;
+    schedule.expected_cost = next[lots];
+    schedule.used_convex_path = use_convex;
+    schedule.trades.resize(steps);
+    size_t q = lots;
+    for (size_t t = 0; t < steps; ++t) {
+        size_t x = static_cast<size_t>(trades[t * width + q]);
+        schedule.trades[t] = x * config.lot_size;
+        q -= x;
+    }
+    return schedule;
+}
+
+} // namespace
+
+DPSchedule solve_optimal_schedule(const DPConfig& config, const DPCostModel& model) {
+    return solve(config, model, model.convex());
+}
+
+DPSchedule solve_optimal_schedule_exhaustive(const DPConfig& config, const DPCostModel& model) {
+    return solve(config, model, false);
+}
+
+} // namespace execution
@@ -0,0 +1,137 @@
+#include "execution_cost.hpp"
+#include "kernels.hpp"
+#include "parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace execution {
+
+CostGradient history_cost_gradient(
+    const std::vector<double>& prices,
+    const std::vector<double>& volumes,
+    const Order& order,
+    double eta,
+    double risk_aversion,
+    const CostModel& model,
+    size_t num_threads
+) {
+    if (prices.size() != volumes.size()) {
+        throw std::invalid_argument("prices and volumes must have the same length");
+    }
+    // isfinite first: NaN would slip through both comparisons
+    if (order.num_slices <= 0 || !std::isfinite(eta) || eta <= 0.0 || !std::isfinite(risk_aversion) || risk_aversion < 0.0) {
+        throw std::invalid_argument("need num_slices > 0, finite eta > 0, finite risk_aversion >= 0");
+    }
+
+    using D = Dual<2>;
+    size_t n = static_cast<size_t>(order.num_slices);
+    size_t num_starts = prices.size() >= n ? prices.size() - n + 1 : 0;
+    double sign = side_sign(order.direction);
+    CostParams<D> params{D::variable(eta, 0), D::variable(risk_aversion, 1)};
+
+    // windows with a zero-volume day have undefined participation
+    std::vector<size_t> last_zero(prices.size(), SIZE_MAX);
+    size_t last = SIZE_MAX;
+    for (size_t i = 0; i < volumes.size(); ++i) {
+        if (!(volumes[i] > 0.0)) {
+            last = i;
+        }
+        last_zero[i] = last;
+    }
+
+    struct Partial {
+        D cost;
+        D risk;
+        uint64_t count = 0;
+    };
+    std::vector<Partial> partials(resolve_num_threads(num_threads));
+
+    // Schedule depends on the parameters only: built once per call, not per start
+    const CostSchedule<D> schedule = cost_schedule<D>(n, params, model);
+    parallel_for(num_starts, num_threads, [&](size_t tid, size_t begin, size_t end) {
+        Partial local;
+        for (size_t s = begin; s < end; ++s) {
+            size_t z = last_zero[s + n - 1];
+            if (z != SIZE_MAX && z >= s) {
+                continue;
+            }
+            auto c = execution_cost(prices.data() + s, volumes.data() + s, order.size, sign, params, schedule);
+            local.cost += c.cost_bps;
+            local.risk += c.risk_bps;
+            ++local.count;
+        }
+        partials[tid] = local;
+    });
+
+    Partial total;
+    for (const auto& p : partials) {
+        total.cost += p.cost;
+        total.risk += p.risk;
+        total.count += p.count;
+    }
+
+    CostGradient out{0.0, 0.0, 0.0, 0.0, 0.0, total.count};
+    if (total.count == 0) {
+        return out;
+    }
+    double inv = 1.0 / static_cast<double>(total.count);
+    D objective = total.cost + total.risk;
+    out.objective_bps = objective.v * inv;
+    out.cost_bps = total.cost.v * inv;
+    out.risk_bps = total.risk.v * inv;
+    out.d_eta = objective.d[0] * inv;
+    out.d_risk_aversion = objective.d[1] * inv;
+    return out;
+}
+
+TuningResult tune_risk_aversion(
+    const std::vector<double>& prices,
+    const std::vector<double>& volumes,
+    const Order& order,
+    double eta,
+    double initial_risk_aversion,
+    const CostModel& model,
+    int max_iterations,
+    size_t num_threads
+) {
+    if (!std::isfinite(initial_risk_aversion) || initial_risk_aversion <= 0.0) {
+        throw std::invalid_argument("initial_risk_aversion must be positive and finite");
+    }
+
+    // optimise u = log(lambda) so lambda stays positive, d/du = lambda * d/dlambda
+    double u = std::log(initial_risk_aversion);
+    double step = 1.0;
+    CostGradient g = history_cost_gradient(prices, volumes, order, eta, std::exp(u), model, num_threads);
+
+    int it = 0;
+    for (; it < max_iterations; ++it) {
+        double grad_u = std::exp(u) * g.d_risk_aversion;
+        if (std::abs(grad_u) < 1e-9) {
+            break;
+        }
+
+        // backtracking: shrink the step until the objective improves
+        bool improved = false;
+        while (step > 1e-6) {
+            double candidate = u - step * grad_u / std::max(1.0, std::abs(grad_u));
+            CostGradient trial = history_cost_gradient(prices, volumes, order, eta, std::exp(candidate), model, num_threads);
+            if (trial.objective_bps < g.objective_bps) {
+                u = candidate;
+                g = trial;
+                step *= 1.5;
+                improved = true;
+                break;
+            }
+            step *= 0.5;
+        }
+        if (!improved) {
+            break;
+        }
+    }
+
+    return TuningResult{std::exp(u), g.objective_bps, g.d_eta, it};
+}
+
+} // namespace execution
@@ -0,0 +1,138 @@
+#include "execution_env.hpp"
+#include "parallel.hpp"
+#include "random.hpp"
+#include "regime_analytics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace execution {
+
+ExecutionEnv::ExecutionEnv(const std::vector<double>& prices, const std::vector<double>& volumes, const EnvConfig& config)
+    : prices_(prices), volumes_(volumes), config_(config) {
+    if (prices.size() != volumes.size()) {
+        throw std::invalid_argument("prices and volumes must have the same length");
+    }
+    if (config.num_envs == 0 || config.horizon == 0 || config.order_size <= 0.0) {
+        throw std::invalid_argument("need num_envs > 0, horizon > 0, order_size > 0");
+    }
+
+    // today's volume vs trailing 20d average (1 when undefined)
+    volume_ratio_ = relative_volume(volumes_, 1, 20);
+    for (double& r : volume_ratio_) {
+        if (std::isnan(r)) {
+            r = 1.0;
+        }
+    }
+
+    // episode windows need volume every day (participation must be defined)
+    // and a positive finite price (drift divides by the arrival price)
+    size_t h = config.horizon;
+    size_t run = 0;     // consecutive usable days ending at i
+    for (size_t i = 0; i < volumes_.size(); ++i) {
+        bool usable = volumes_[i] > 0.0 && std::isfinite(prices_[i]) && prices_[i] > 0.0;
+        run = usable ? run + 1 : 0;
+        if (run >= h) {
+            valid_starts_.push_back(static_cast<uint32_t>(i + 1 - h));
+        }
+    }
+    if (valid_starts_.empty()) {
+        throw std::invalid_argument("history too short for the horizon");
+    }
+
+    size_t n = config.num_envs;
+    start_.resize(n);
+    step_.resize(n);
+    remaining_.resize(n);
+    arrival_.resize(n);
+    episode_cost_.resize(n);
+    rng_.resize(n);
+    obs_.resize(n * OBS_DIM);
+    rewards_.resize(n);
+    dones_.resize(n);
+    last_episode_cost_.resize(n);
+
+    uint64_t seed = config.seed;
+    for (size_t i = 0; i < n; ++i) {
+        rng_[i] = splitmix64(seed);
+    }
+    if (config.num_threads > 1) {
+        pool_ = std::make_unique<WorkerPool>(config.num_threads);
+    }
+    reset();
+}
+
+void ExecutionEnv::reset_env(size_t i) {
+    uint64_t pick = splitmix64(rng_[i]) % valid_starts_.size();
+    start_[i] = valid_starts_[pick];
+    step_[i] = 0;
+    remaining_[i] = config_.order_size;
+    arrival_[i] = prices_[start_[i]];
+    episode_cost_[i] = 0.0;
+}
+
+void ExecutionEnv::write_obs(size_t i) {
+    size_t day = start_[i] + step_[i];
+    float* o = obs_.data() + i * OBS_DIM;
+    o[0] = static_cast<float>(remaining_[i] / config_.order_size);
+    o[1] = static_cast<float>(static_cast<double>(config_.horizon - step_[i]) / config_.horizon);
+    o[2] = static_cast<float>((prices_[day] / arrival_[i] - 1.0) * 100.0);
+    o[3] = static_cast<float>(volume_ratio_[day]);
+}
+
+void ExecutionEnv::reset() {
+    for (size_t i = 0; i < config_.num_envs; ++i) {
+        reset_env(i);
+        write_obs(i);
+        rewards_[i] = 0.0f;
+        dones_[i] = 0;
+        last_episode_cost_[i] = 0.0f;
+    }
+}
+
+void ExecutionEnv::step_range(const float* actions, size_t begin, size_t end) {
+    double inv_size = 1.0 / config_.order_size;
+    for (size_t i = begin; i < end; ++i) {
+        size_t day = start_[i] + step_[i];
+        bool last = step_[i] + 1 == config_.horizon;
+
+        // clamp passes NaN through; a non-finite action holds instead of poisoning the episode
+        double action = static_cast<double>(actions[i]);
+        double fraction = std::isfinite(action) ? std::clamp(action, 0.0, 1.0) : 0.0;
+        double traded = last ? remaining_[i] : fraction * remaining_[i];
+        double price = prices_[day];
+
+        double drift_bps = (price - arrival_[i]) / arrival_[i] * 10000.0;
+        double impact_bps = config_.eta * traded / volumes_[day];
+        double cost_bps = traded * inv_size * (drift_bps + impact_bps);
+
+        remaining_[i] -= traded;
+        episode_cost_[i] += cost_bps;
+        rewards_[i] = static_cast<float>(-cost_bps);
+        ++step_[i];
+
+        if (last) {
+            dones_[i] = 1;
+            last_episode_cost_[i] = static_cast<float>(episode_cost_[i]);
+            reset_env(i);
+        } else {
+            dones_[i] = 0;
+        }
+        write_obs(i);
+    }
+}
+
+ExecutionEnv::~ExecutionEnv() = default;
+
+void ExecutionEnv::step(const float* actions) {
+    if (!pool_) {
+        step_range(actions, 0, config_.num_envs);
+        return;
+    }
+    pool_->run(config_.num_envs, [&](size_t, size_t begin, size_t end) {
+        step_range(actions, begin, end);
+    });
+}
+
+} // namespace execution
@@ -0,0 +1,207 @@
+#include "feature_matrix.hpp"
+#include "parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace execution {
+
+namespace {
+
+constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+struct Block {
+    size_t symbol;
+    size_t begin;       // bar range inside the symbol
+    size_t end;
+    size_t row;         // first output row
+};
+
+inline double log_return(const std::vector<double>& close, size_t j) {
+    return std::log(close[j] / close[j - 1]);
+}
+
+inline double log_range_sq(const MarketData& md, size_t j) {
+    double r = std::log(md.high[j] / md.low[j]);
+    return r * r;
+}
+
+// Rolling mean of f(j) over (i - w, i] for i in [begin, end), first valid i = first
+// A non-finite f(j) restarts the sums: the windows holding it are NaN, and the
+// first window past it is exact again instead of carrying NaN / inf to the block edge
+template <typename Fn, typename Out>
+void rolling(size_t begin, size_t end, size_t w, size_t first, double* out, Fn&& f, Out&& emit) {
+    size_t start = std::max(begin, first);
+    for (size_t i = begin; i < std::min(end, start); ++i) {
+        out[i - begin] = NaN;
+    }
+    if (start >= end) {
+        return;
+    }
+    // warm the window for the first row of the block, then slide
+    double sum = 0.0;
+    double sq = 0.0;
+    size_t run = 0;     // finite values in a row ending at j
+    for (size_t j = start + 1 - w; j < end; ++j) {
+        double x = f(j);
+        if (!std::isfinite(x)) {
+            sum = 0.0;
+            sq = 0.0;
+            run = 0;
+        } else {
+            sum += x;
+            sq += x * x;
+            if (++run > w) {
+                double drop = f(j - w);
+                sum -= drop;
+                sq -= drop * drop;
+            }
+        }
+        if (j >= start) {
+            out[j - begin] = run >= w ? emit(j, sum, sq) : NaN;
+        }
+    }
+}
+
+void compute_feature(const MarketData& md, const FeatureSpec& spec, size_t begin, size_t end, double* out) {
+    const auto& c = md.close;
+    size_t w = spec.window;
+
+    switch (spec.kind) {
+        case FeatureKind::Return:
+            for (size_t i = begin; i < end; ++i) {
+                out[i - begin] = i >= w ? c[i] / c[i - w] - 1.0 : NaN;
+            }
+            break;
+
+        case FeatureKind::LogReturn:
+            for (size_t i = begin; i < end; ++i) {
+                out[i - begin] = i >= w ? std::log(c[i] / c[i - w]) : NaN;
+            }
+            break;
+
+        case FeatureKind::RollingVol:
+            rolling(begin, end, w, w, out,
+                [&](size_t j) { return log_return(c, j); },
+                [&](size_t, double sum, double sq) {
+                    double mean = sum / w;
+                    double var = (sq - w * mean * mean) / (w - 1);
+                    return var > 0.0 ? std::sqrt(var) : 0.0;
+                });
+            break;
+
+        case FeatureKind::VolumeRatio:
+            rolling(begin, end, w, w - 1, out,
+                [&](size_t j) { return md.volume[j]; },
+                [&](size_t i, double sum, double) {
+                    double mean = sum / w;
+                    return mean > 0.0 ? md.volume[i] / mean : NaN;
+                });
+            break;
+
+        case FeatureKind::Range:
+            for (size_t i = begin; i < end; ++i) {
+                out[i - begin] = (md.high[i] - md.low[i]) / c[i];
+            }
+            break;
+
+        case FeatureKind::Gap:
+            for (size_t i = begin; i < end; ++i) {
+                out[i - begin] = i >= 1 ? md.open[i] / c[i - 1] - 1.0 : NaN;
+            }
+            break;
+
+        case FeatureKind::ParkinsonVol: {
+            const double scale = 1.0 / (4.0 * std::log(2.0));
+            rolling(begin, end, w, w - 1, out,
+                [&](size_t j) { return log_range_sq(md, j); },
+                [&](size_t, double sum, double) { return std::sqrt(std::max(0.0, sum / w * scale)); });
+            break;
+        }
+    }
+}
+
+} // namespace
+
+FeatureMatrixBuilder& FeatureMatrixBuilder::add(FeatureKind kind, size_t window) {
+    bool needs_two = kind == FeatureKind::RollingVol;
+    if (window == 0 || (needs_two && window < 2)) {
+        throw std::invalid_argument("feature window too small");
+    }
+    features_.push_back(FeatureSpec{kind, window});
+    return *this;
+}
+
+std::vector<std::string> FeatureMatrixBuilder::names() const {
+    std::vector<std::string> out;
+    for (const auto& f : features_) {
+        std::string w = std::to_string(f.window);
+        switch (f.kind) {
+            case FeatureKind::Return: out.push_back("return_" + w); break;
+            case FeatureKind::LogReturn: out.push_back("log_return_" + w); break;
+            case FeatureKind::RollingVol: out.push_back("rolling_vol_" + w); break;
+            case FeatureKind::VolumeRatio: out.push_back("volume_ratio_" + w); break;
+            case FeatureKind::Range: out.push_back("range"); break;
+            case FeatureKind::Gap: out.push_back("gap"); break;
+            case FeatureKind::ParkinsonVol: out.push_back("parkinson_vol_" + w); break;
+        }
+    }
+    return out;
+}
+
+FeatureMatrix FeatureMatrixBuilder::build(
+    const std::vector<MarketData>& symbols,
+    MatrixLayout layout,
+    size_t num_threads
+) const {
+    FeatureMatrix m;
+    m.cols = features_.size();
+    m.layout = layout;
+
+    std::vector<Block> blocks;
+    m.symbol_offsets.push_back(0);
+    for (size_t s = 0; s < symbols.size(); ++s) {
+        const MarketData& md = symbols[s];
+        size_t n = md.size();
+        if (md.open.size() != n || md.high.size() != n || md.low.size() != n || md.volume.size() != n) {
+            throw std::invalid_argument("all OHLCV columns must have the same length");
+        }
+        for (size_t b = 0; b < n; b += BLOCK_ROWS) {
+            blocks.push_back(Block{s, b, std::min(n, b + BLOCK_ROWS), m.rows + b});
+        }
+        m.rows += n;
+        m.symbol_offsets.push_back(m.rows);
+    }
+
+    m.data.resize(m.rows * m.cols);
+    double* data = m.data.data();
+    size_t rows = m.rows;
+    size_t cols = m.cols;
+
+    parallel_for(blocks.size(), num_threads, [&](size_t, size_t first, size_t last) {
+        std::vector<double> column(BLOCK_ROWS);
+        for (size_t b = first; b < last; ++b) {
+            const Block& blk = blocks[b];
+            const MarketData& md = symbols[blk.symbol];
+            size_t len = blk.end - blk.begin;
+
+            for (size_t f = 0; f < cols; ++f) {
+                if (layout == MatrixLayout::ColumnMajor) {
+                    // contiguous run in the output column, write in place
+                    compute_feature(md, features_[f], blk.begin, blk.end, data + f * rows + blk.row);
+                } else {
+                    compute_feature(md, features_[f], blk.begin, blk.end, column.data());
+                    double* dst = data + blk.row * cols + f;
+                    for (size_t i = 0; i < len; ++i) {
+                        dst[i * cols] = column[i];
+                    }
+                }
+            }
+        }
+    });
+    return m;
+}
+
+} // namespace execution
@@ -0,0 +1,184 @@
+#include "impact_calibration.hpp"
+#include "parallel.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace execution {
+
+namespace {
+
+constexpr size_t MAX_PARAMS = 2;
+
+// Sufficient statistics of a linear regression
+struct NormalEquations {
+    double xtx[MAX_PARAMS][MAX_PARAMS] = {};
+    double xty[MAX_PARAMS] = {};
+    double yty = 0.0;
+    double y_sum = 0.0;
+    uint64_t n = 0;
+
+    void add(const double* x, size_t p, double y) {
+        for (size_t i = 0; i < p; ++i) {
+            for (size_t j = 0; j <= i; ++j) {
+                xtx[i][j] += x[i] * x[j];
+            }
+            xty[i] += x[i] * y;
+        }
+        yty += y * y;
+        y_sum += y;
+        ++n;
+    }
+
+    void merge(const NormalEquations& o, size_t p) {
+        for (size_t i = 0; i < p; ++i) {
+            for (size_t j = 0; j <= i; ++j) {
+                xtx[i][j] += o.xtx[i][j];
+            }
+            xty[i] += o.xty[i];
+        }
+        yty += o.yty;
+        y_sum += o.y_sum;
+        n += o.n;
+    }
+
+    // Cholesky on the lower triangle: X'X = L L', then two triangular solves
+    void solve(size_t p, double* beta) const {
+        double l[MAX_PARAMS][MAX_PARAMS] = {};
+        for (size_t i = 0; i < p; ++i) {
+            for (size_t j = 0; j <= i; ++j) {
+                double s = xtx[i][j];
+                for (size_t k = 0; k < j; ++k) {
+                    s -= l[i][k] * l[j][k];
+                }
+                if (i == j) {
+                    if (s <= 1e-12 * (1.0 + std::abs(xtx[i][i]))) {
+                        throw std::runtime_error("impact regression is singular (too few or identical fills)");
+                    }
+                    l[i][i] = std::sqrt(s);
+                } else {
+                    l[i][j] = s / l[j][j];
+                }
+            }
+        }
+        double z[MAX_PARAMS];
+        for (size_t i = 0; i < p; ++i) {
+            double s = xty[i];
+            for (size_t k = 0; k < i; ++k) s -= l[i][k] * z[k];
+            z[i] = s / l[i][i];
+        }
+        for (size_t i = p; i-- > 0;) {
+            double s = z[i];
+            for (size_t k = i + 1; k < p; ++k) s -= l[k][i] * beta[k];
+            beta[i] = s / l[i][i];
+        }
+    }
+
+    // 1 - SSE / SST from the accumulated sums; SST is taken about the mean only
+    // when the model has an intercept, about zero otherwise (uncentered R^2)
+    double r_squared(size_t p, const double* beta, bool intercept) const {
+        double sse = yty;
+        for (size_t i = 0; i < p; ++i) {
+            sse -= 2.0 * beta[i] * xty[i];
+            for (size_t j = 0; j < p; ++j) {
+                double v = i >= j ? xtx[i][j] : xtx[j][i];
+                sse += beta[i] * v * beta[j];
+            }
+        }
+        double sst = intercept ? yty - y_sum * y_sum / n : yty;
+        return sst > 0.0 ? 1.0 - sse / sst : 0.0;
+    }
+};
+
+double fixed_exponent(ImpactModelKind kind) {
+    return kind == ImpactModelKind::Linear ? 1.0 : 0.5;
+}
+
+} // namespace
+
+ImpactFit calibrate_impact(
+    const FillRecords& fills,
+    ImpactModelKind kind,
+    bool fit_intercept,
+    size_t num_threads
+) {
+    size_t n = fills.count();
+    if (fills.adv.size() != n || fills.volatility.size() != n || fills.cost_bps.size() != n) {
+        throw std::invalid_argument("all fill columns must have the same length");
+    }
+
+    bool power_law = kind == ImpactModelKind::PowerLaw;
+    bool intercept = power_law || fit_intercept;    // log a is the power-law intercept
+    size_t p = intercept ? 2 : 1;
+    double exponent = power_law ? 0.0 : fixed_exponent(kind);
+
+    std::vector<NormalEquations> partials(resolve_num_threads(num_threads));
+    parallel_for(n, num_threads, [&](size_t tid, size_t begin, size_t end) {
+        NormalEquations local;
+        double x[MAX_PARAMS];
+        for (size_t i = begin; i < end; ++i) {
+            double adv = fills.adv[i];
+            double size = fills.size[i];
+            double sigma_bps = fills.volatility[i] * 10000.0;
+            double cost = fills.cost_bps[i];
+            // One inf row would swamp the sums of every other fill
+            if (!std::isfinite(adv) || !std::isfinite(size) || !std::isfinite(sigma_bps) || !std::isfinite(cost)
+                || !(adv > 0.0) || !(size > 0.0) || !(sigma_bps > 0.0)) {
+                continue;
+            }
+            double participation = size / adv;
+
+            if (power_law) {
+                // log(cost / sigma) = log a + b log(participation)
+                if (!(cost > 0.0)) {
+                    continue;
+                }
+                x[0] = 1.0;
+                x[1] = std::log(participation);
+                local.add(x, 2, std::log(cost / sigma_bps));
+            } else {
+                double driver = sigma_bps * (kind == ImpactModelKind::Linear ? participation : std::sqrt(participation));
+                if (intercept) {
+                    x[0] = 1.0;
+                    x[1] = driver;
+                } else {
+                    x[0] = driver;
+                }
+                local.add(x, p, cost);
+            }
+        }
+        partials[tid] = local;
+    });
+
+    NormalEquations total;
+    for (const auto& part : partials) {
+        total.merge(part, p);
+    }
+    if (total.n < p) {
+        throw std::runtime_error("not enough valid fills to calibrate");
+    }
+
+    double beta[MAX_PARAMS] = {};
+    total.solve(p, beta);
+
+    ImpactFit fit;
+    fit.kind = kind;
+    fit.num_fills = total.n;
+    fit.r_squared = total.r_squared(p, beta, intercept);
+    if (power_law) {
+        fit.coefficient = std::exp(beta[0]);
+        fit.exponent = beta[1];
+        fit.intercept_bps = 0.0;
+    } else {
+        fit.coefficient = intercept ? beta[1] : beta[0];
+        fit.exponent = exponent;
+        fit.intercept_bps = intercept ? beta[0] : 0.0;
+    }
+    return fit;
+}
+
+double predict_impact_bps(const ImpactFit& fit, double size, double adv, double volatility) {
+    return fit.intercept_bps + fit.coefficient * volatility * 10000.0 * std::pow(size / adv, fit.exponent);
+}
+
+} // namespace execution
@@ -0,0 +1,155 @@
+#include "intraday_generator.hpp"
+#include "random.hpp"
+#include "session_calendar.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace execution {
+
+IntradayBarGenerator::IntradayBarGenerator(const MarketData& daily, const IntradayConfig& config)
+    : daily_(daily), config_(config) {
+    size_t n = daily.size();
+    if (daily.open.size() != n || daily.high.size() != n || daily.low.size() != n || daily.volume.size() != n) {
+        throw std::invalid_argument("all OHLCV columns must have the same length");
+    }
+    if (!daily.timestamps.empty() && daily.timestamps.size() != n) {
+        throw std::invalid_argument("timestamps must be empty or as long as the bars");
+    }
+    if (config.minutes_per_day < 3 || config.minutes_per_day > MAX_MINUTES) {
+        throw std::invalid_argument("minutes_per_day must be in [3, MAX_MINUTES]");
+    }
+    if (!std::isfinite(config.volume_u_depth) || config.volume_u_depth < -1.0) {
+        // below -1 the edge weights go negative and the profile total can reach zero
+        throw std::invalid_argument("volume_u_depth must be finite and >= -1");
+    }
+
+    // U shape: 1 + depth * x^2, x from -1 (open) to 1 (close)
+    size_t m = config.minutes_per_day;
+    volume_profile_.resize(m);
+    double total = 0.0;
+    for (size_t k = 0; k < m; ++k) {
+        double x = 2.0 * k / (m - 1) - 1.0;
+        volume_profile_[k] = 1.0 + config.volume_u_depth * x * x;
+        total += volume_profile_[k];
+    }
+    for (double& w : volume_profile_) {
+        w /= total;
+    }
+}
+
+// Brownian bridge pinned at (t0, v0) and (t1, v1), fills path[t0 + 1 .. t1 - 1]
+void IntradayBarGenerator::bridge(uint64_t key, size_t t0, double v0, size_t t1, double v1, double step_sigma, double* path) const {
+    if (t1 <= t0 + 1) {
+        return;
+    }
+    // free walk first (path holds W_j), then pull its end back to zero
+    double w = 0.0;
+    for (size_t j = t0 + 1; j <= t1; ++j) {
+        w += step_sigma * counter_normal(key, j);
+        if (j < t1) {
+            path[j] = w;
+        }
+    }
+    double span = static_cast<double>(t1 - t0);
+    for (size_t j = t0 + 1; j < t1; ++j) {
+        double frac = (j - t0) / span;
+        path[j] = v0 + (v1 - v0) * frac + path[j] - frac * w;
+    }
+}
+
+void IntradayBarGenerator::generate_day(size_t day, MarketData& out) const {
+    size_t m = config_.minutes_per_day;
+    out.clear();
+
+    double o = daily_.open[day];
+    double c = daily_.close[day];
+    double h = std::max({daily_.high[day], o, c});
+    double l = std::min({daily_.low[day], o, c});
+    double v = daily_.volume[day] > 0.0 ? daily_.volume[day] : 0.0;
+
+    // m + 1 path points on the stack, bar k spans points k and k + 1
+    double p[MAX_MINUTES + 1];
+    p[0] = o;
+    p[m] = c;
+
+    uint64_t key = counter_random(config_.seed, day);
+    if (h - l <= 0.0) {
+        std::fill(p + 1, p + m, o);
+    } else {
+        // interior anchors for the extremes the endpoints do not already touch
+        size_t anchor_t[2];
+        double anchor_v[2];
+        size_t num_anchors = 0;
+        size_t t_high = 1 + counter_random(key, ~uint64_t{0}) % (m - 1);
+        size_t t_low = 1 + counter_random(key, ~uint64_t{1}) % (m - 1);
+        if (t_low == t_high) {
+            t_low = t_high == m - 1 ? t_high - 1 : t_high + 1;
+        }
+        if (h > std::max(o, c)) {
+            anchor_t[num_anchors] = t_high;
+            anchor_v[num_anchors++] = h;
+        }
+        if (l < std::min(o, c)) {
+            anchor_t[num_anchors] = t_low;
+            anchor_v[num_anchors++] = l;
+        }
+        if (num_anchors == 2 && anchor_t[0] > anchor_t[1]) {
+            std::swap(anchor_t[0], anchor_t[1]);
+            std::swap(anchor_v[0], anchor_v[1]);
+        }
+
+        double step_sigma = (h - l) / (2.0 * std::sqrt(static_cast<double>(m)));
+        size_t t_prev = 0;
+        double v_prev = o;
+        for (size_t a = 0; a < num_anchors; ++a) {
+            p[anchor_t[a]] = anchor_v[a];
+            bridge(key, t_prev, v_prev, anchor_t[a], anchor_v[a], step_sigma, p);
+            t_prev = anchor_t[a];
+            v_prev = anchor_v[a];
+        }
+        bridge(key, t_prev, v_prev, m, c, step_sigma, p);
+
+        for (size_t j = 1; j < m; ++j) {
+            p[j] = std::clamp(p[j], l, h);
+        }
+    }
+
+    // ns since the epoch; without dates, day i is i days after 1970-01-01
+    bool has_dates = !daily_.timestamps.empty();
+    int64_t days = has_dates ? days_from_civil(static_cast<int32_t>(daily_.timestamps[day])) : static_cast<int64_t>(day);
+    int64_t open_ns = days * DAY_NS + static_cast<int64_t>(OPEN_MINUTE) * MINUTE_NS;
+    for (size_t k = 0; k < m; ++k) {
+        int64_t ts = open_ns + static_cast<int64_t>(k) * MINUTE_NS;
+        double bar_open = p[k];
+        double bar_close = p[k + 1];
+        out.push_back(ts, bar_open, std::max(bar_open, bar_close), std::min(bar_open, bar_close), bar_close, v * volume_profile_[k]);
+    }
+}
+
+std::vector<double> intraday_twap_slippage(
+    const MarketData& daily,
+    size_t slices_per_day,
+    const IntradayConfig& config
+) {
+    if (slices_per_day == 0 || slices_per_day > config.minutes_per_day) {
+        throw std::invalid_argument("slices_per_day must be in [1, minutes_per_day]");
+    }
+    IntradayBarGenerator generator(daily, config);
+    std::vector<double> slippage(daily.size());
+    size_t m = config.minutes_per_day;
+
+    generator.stream([&](size_t day, const MarketData& bars, size_t) {
+        double sum = 0.0;
+        for (size_t i = 0; i < slices_per_day; ++i) {
+            size_t minute = static_cast<size_t>((i + 0.5) * m / slices_per_day);
+            sum += bars.close[minute];
+        }
+        double open = bars.open[0];
+        slippage[day] = (sum / slices_per_day - open) / open * 10000.0;
+    });
+    return slippage;
+}
+
+} // namespace execution
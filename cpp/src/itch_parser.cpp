@@ -0,0 +1,130 @@
+#include "itch_parser.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+namespace execution {
+
+namespace {
+
+inline void store_be16(uint8_t* p, uint16_t v) {
+    v = __builtin_bswap16(v);
+    std::memcpy(p, &v, sizeof(v));
+}
+
+inline void store_be32(uint8_t* p, uint32_t v) {
+    v = __builtin_bswap32(v);
+    std::memcpy(p, &v, sizeof(v));
+}
+
+inline void store_be64(uint8_t* p, uint64_t v) {
+    v = __builtin_bswap64(v);
+    std::memcpy(p, &v, sizeof(v));
+}
+
+inline void store_be48(uint8_t* p, uint64_t v) {
+    store_be16(p, static_cast<uint16_t>(v >> 32));
+    store_be32(p + 2, static_cast<uint32_t>(v));
+}
+
+} // namespace
+
+/**
+ * Mapped file
+ */
+MappedFile::MappedFile(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("cannot open file: " + path);
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw std::runtime_error("cannot stat file: " + path);
+    }
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ > 0) {
+        void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error("cannot map file: " + path);
+        }
+        ::madvise(p, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<const uint8_t*>(p);
+    }
+    ::close(fd);    // the mapping stays valid
+}
+
+MappedFile::~MappedFile() {
+    if (data_ != nullptr) {
+        ::munmap(const_cast<uint8_t*>(data_), size_);
+    }
+}
+
+/**
+ * Writer
+ */
+uint8_t* ItchWriter::begin_message(char type, size_t len, uint16_t locate, uint64_t timestamp) {
+    size_t pos = buffer_.size();
+    buffer_.resize(pos + 2 + len, 0);
+    uint8_t* p = buffer_.data() + pos;
+    store_be16(p, static_cast<uint16_t>(len));
+    uint8_t* msg = p + 2;
+    msg[0] = static_cast<uint8_t>(type);
+    store_be16(msg + 1, locate);
+    store_be48(msg + 5, timestamp);     // tracking number (3-4) left at 0
+    return msg;
+}
+
+void ItchWriter::add(uint16_t locate, uint64_t timestamp, uint64_t order_ref, Side side, uint32_t shares, uint32_t price, const char* stock) {
+    uint8_t* msg = begin_message('A', 36, locate, timestamp);
+    store_be64(msg + 11, order_ref);
+    msg[19] = side == Side::Buy ? 'B' : 'S';
+    store_be32(msg + 20, shares);
+    // stock symbol: left-justified, space padded
+    std::memset(msg + 24, ' ', 8);
+    std::memcpy(msg + 24, stock, std::min<size_t>(std::strlen(stock), 8));
+    store_be32(msg + 32, price);
+}
+
+void ItchWriter::execute(uint16_t locate, uint64_t timestamp, uint64_t order_ref, uint32_t shares, uint64_t match_number) {
+    uint8_t* msg = begin_message('E', 31, locate, timestamp);
+    store_be64(msg + 11, order_ref);
+    store_be32(msg + 19, shares);
+    store_be64(msg + 23, match_number);
+}
+
+void ItchWriter::cancel(uint16_t locate, uint64_t timestamp, uint64_t order_ref, uint32_t shares) {
+    uint8_t* msg = begin_message('X', 23, locate, timestamp);
+    store_be64(msg + 11, order_ref);
+    store_be32(msg + 19, shares);
+}
+
+void ItchWriter::remove(uint16_t locate, uint64_t timestamp, uint64_t order_ref) {
+    uint8_t* msg = begin_message('D', 19, locate, timestamp);
+    store_be64(msg + 11, order_ref);
+}
+
+void ItchWriter::replace(uint16_t locate, uint64_t timestamp, uint64_t original_ref, uint64_t new_ref, uint32_t shares, uint32_t price) {
+    uint8_t* msg = begin_message('U', 35, locate, timestamp);
+    store_be64(msg + 11, original_ref);
+    store_be64(msg + 19, new_ref);
+    store_be32(msg + 27, shares);
+    store_be32(msg + 31, price);
+}
+
+void ItchWriter::save(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        throw std::runtime_error("cannot open file: " + path);
+    }
+    out.write(reinterpret_cast<const char*>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()));
+}
+
+} // namespace execution
@@ -0,0 +1,109 @@
+#include "lane_batch.hpp"
+#include "parallel.hpp"
+
+#include <stdexcept>
+
+namespace execution {
+
+namespace {
+
+void validate(size_t size, const std::vector<size_t>& starts, size_t num_slices, size_t lanes) {
+    if (num_slices == 0) {
+        throw std::invalid_argument("num_slices must be positive");
+    }
+    if (lanes != 4 && lanes != 8 && lanes != 16) {
+        throw std::invalid_argument("lanes must be 4, 8 or 16");
+    }
+    for (size_t s : starts) {
+        if (s > size || size - s < num_slices) {
+            throw std::out_of_range("order window runs past the data");
+        }
+    }
+}
+
+template <size_t Lanes, bool Clean>
+void run_groups(const double* prices, const double* volumes, const size_t* starts,
+                size_t num_orders, size_t num_slices, double sign, double* twap, double* vwap, size_t num_threads) {
+    size_t num_groups = num_orders / Lanes;
+    parallel_for(num_groups, num_threads, [&](size_t, size_t begin, size_t end) {
+        for (size_t g = begin; g < end; ++g) {
+            size_t i = g * Lanes;
+            twap_vwap_lanes<Lanes, Clean>(prices, volumes, starts + i, num_slices, sign, twap + i, vwap + i);
+        }
+    });
+}
+
+// Full lane groups; returns the index where the tail starts
+template <bool Clean>
+size_t run_lanes(const double* p, const double* v, const std::vector<size_t>& starts, size_t num_slices,
+                 double sign, size_t lanes, size_t num_threads, BatchSlippage& out) {
+    const size_t n = starts.size();
+    out.twap_bps.resize(n);
+    out.vwap_bps.resize(n);
+    double* twap = out.twap_bps.data();
+    double* vwap = out.vwap_bps.data();
+    switch (lanes) {
+    case 4:
+        run_groups<4, Clean>(p, v, starts.data(), n, num_slices, sign, twap, vwap, num_threads);
+        break;
+    case 8:
+        run_groups<8, Clean>(p, v, starts.data(), n, num_slices, sign, twap, vwap, num_threads);
+        break;
+    default:
+        run_groups<16, Clean>(p, v, starts.data(), n, num_slices, sign, twap, vwap, num_threads);
+        break;
+    }
+    return n - n % lanes;
+}
+
+} // namespace
+
+BatchSlippage batch_slippage(const std::vector<double>& prices, const std::vector<double>& volumes,
+                             const std::vector<size_t>& starts, size_t num_slices,
+                             const std::string& direction, size_t lanes, size_t num_threads) {
+    if (prices.size() != volumes.size()) {
+        throw std::invalid_argument("prices and volumes must have the same length");
+    }
+    validate(prices.size(), starts, num_slices, lanes);
+
+    const double sign = side_sign(direction);
+    const double* p = prices.data();
+    const double* v = volumes.data();
+    BatchSlippage out;
+    size_t tail = run_lanes<false>(p, v, starts, num_slices, sign, lanes, num_threads, out);
+
+    // Tail that does not fill a group
+    for (size_t i = tail; i < starts.size(); ++i) {
+        const double* pw = p + starts[i];
+        out.twap_bps[i] = slippage_bps(twap_avg_price(pw, num_slices), pw[0], sign);
+        out.vwap_bps[i] = slippage_bps(vwap_avg_price(pw, v + starts[i], num_slices), pw[0], sign);
+    }
+    return out;
+}
+
+BatchSlippage batch_slippage(const CleanData& data, const std::vector<size_t>& starts, size_t num_slices,
+                             const std::string& direction, size_t lanes, size_t num_threads) {
+    if (data.config.volume_nan == NanPolicy::Keep && data.report.nan_volumes > 0) {
+        throw std::invalid_argument("volumes were loaded with NanPolicy::Keep and still hold NaN");
+    }
+    const MarketData& bars = data.bars;
+    validate(bars.size(), starts, num_slices, lanes);
+
+    const double sign = side_sign(direction);
+    const double* p = bars.close.data();
+    const double* v = bars.volume.data();
+    BatchSlippage out;
+    size_t tail = run_lanes<true>(p, v, starts, num_slices, sign, lanes, num_threads, out);
+
+    for (size_t i = tail; i < starts.size(); ++i) {
+        size_t s = starts[i];
+        const double* pw = p + s;
+        double twap = twap_avg_price(pw, num_slices);
+        double vwap = data.has_volume.any(s, s + num_slices) ? vwap_avg_price_clean(pw, v + s, num_slices) : twap;
+        out.twap_bps[i] = slippage_bps(twap, pw[0], sign);
+        out.vwap_bps[i] = slippage_bps(vwap, pw[0], sign);
+    }
+    return out;
+}
+
+} // namespace execution
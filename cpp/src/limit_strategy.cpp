@@ -0,0 +1,324 @@
+#include "limit_strategy.hpp"
+#include "parallel.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace execution {
+
+/**
+ * Book tape
+ */
+void BookTape::record(uint64_t timestamp, TapeEventKind kind, Side side, int64_t price, uint32_t shares, uint32_t level_before) {
+    int64_t bid = book_.best_bid();
+    int64_t ask = book_.best_ask();
+    events_.push_back(TapeEvent{
+        timestamp, price, bid, ask, shares, level_before,
+        bid != 0 ? static_cast<uint32_t>(book_.level(Side::Buy, bid).quantity) : 0u,
+        ask != 0 ? static_cast<uint32_t>(book_.level(Side::Sell, ask).quantity) : 0u,
+        kind, side
+    });
+}
+
+void BookTape::on_add(const ItchAdd& m) {
+    if (m.locate != locate_) {
+        return;
+    }
+    uint32_t before = static_cast<uint32_t>(book_.level(m.side, m.price).quantity);
+    if (book_.add(m.order_ref, m.side, m.price, m.shares)) {
+        record(m.timestamp, TapeEventKind::Add, m.side, m.price, m.shares, before);
+    }
+}
+
+void BookTape::on_execute(const ItchExecute& m) {
+    const BookOrder* resting = m.locate == locate_ ? book_.find(m.order_ref) : nullptr;
+    if (resting == nullptr) {
+        return;
+    }
+    Side side = resting->side;
+    int64_t price = resting->price;
+    uint32_t before = static_cast<uint32_t>(book_.level(side, price).quantity);
+    uint32_t shares = book_.execute(m.order_ref, m.shares);
+    record(m.timestamp, TapeEventKind::Execute, side, price, shares, before);
+}
+
+void BookTape::on_cancel(const ItchCancel& m) {
+    const BookOrder* resting = m.locate == locate_ ? book_.find(m.order_ref) : nullptr;
+    if (resting == nullptr) {
+        return;
+    }
+    Side side = resting->side;
+    int64_t price = resting->price;
+    uint32_t before = static_cast<uint32_t>(book_.level(side, price).quantity);
+    uint32_t shares = book_.cancel(m.order_ref, m.shares);
+    record(m.timestamp, TapeEventKind::Cancel, side, price, shares, before);
+}
+
+void BookTape::on_delete(const ItchDelete& m) {
+    const BookOrder* resting = m.locate == locate_ ? book_.find(m.order_ref) : nullptr;
+    if (resting == nullptr) {
+        return;
+    }
+    Side side = resting->side;
+    int64_t price = resting->price;
+    uint32_t shares = resting->quantity;
+    uint32_t before = static_cast<uint32_t>(book_.level(side, price).quantity);
+    book_.remove(m.order_ref);
+    record(m.timestamp, TapeEventKind::Cancel, side, price, shares, before);
+}
+
+void BookTape::on_replace(const ItchReplace& m) {
+    // same checks as OrderBook::replace, so a rejected replace leaves no delete on the tape
+    const BookOrder* resting = m.locate == locate_ ? book_.find(m.original_ref) : nullptr;
+    if (resting == nullptr || m.new_ref == m.original_ref || book_.find(m.new_ref) != nullptr) {
+        return;
+    }
+    Side side = resting->side;
+    on_delete(ItchDelete{m.locate, m.timestamp, m.original_ref});
+    on_add(ItchAdd{m.locate, m.timestamp, m.new_ref, side, m.shares, m.price, {}});
+}
+
+/**
+ * Passive / aggressive placement
+ */
+namespace {
+
+struct Touch {
+    int64_t bid = 0;
+    int64_t ask = 0;
+    uint32_t bid_size = 0;
+    uint32_t ask_size = 0;
+
+    double mid() const {
+        if (bid != 0 && ask != 0) return 0.5 * (bid + ask);
+        return static_cast<double>(bid != 0 ? bid : ask);
+    }
+};
+
+inline Touch touch_after(const TapeEvent& e) {
+    return Touch{e.best_bid, e.best_ask, e.bid_size, e.ask_size};
+}
+
+// Per-parameterization working state
+struct PlacementState {
+    int64_t price = 0;          // resting price when `resting`
+    double ahead = 0.0;
+    uint32_t remaining = 0;     // of the current slice
+    bool resting = false;
+    uint64_t filled = 0;
+    uint64_t passive_filled = 0;
+    uint64_t unfilled = 0;      // reached a deadline with no far touch to take
+    double notional = 0.0;
+    double capture = 0.0;       // sum of qty * signed (mid - price) / mid
+};
+
+class Placement {
+private:
+    Side side_;
+    double sign_;
+    CancelModel model_;
+
+    void record(PlacementState& s, uint32_t qty, int64_t price, double mid, bool passive) const {
+        s.remaining -= qty;
+        s.filled += qty;
+        s.notional += static_cast<double>(qty) * price;
+        if (mid > 0.0) {
+            s.capture += qty * sign_ * (mid - price) / mid;
+        }
+        if (passive) {
+            s.passive_filled += qty;
+        }
+        if (s.remaining == 0) {
+            s.resting = false;
+        }
+    }
+
+public:
+    Placement(Side side, CancelModel model)
+        : side_(side), sign_(side == Side::Buy ? 1.0 : -1.0), model_(model) {}
+
+    int64_t own_touch(const Touch& t) const { return side_ == Side::Buy ? t.bid : t.ask; }
+    uint32_t own_size(const Touch& t) const { return side_ == Side::Buy ? t.bid_size : t.ask_size; }
+    int64_t far_touch(const Touch& t) const { return side_ == Side::Buy ? t.ask : t.bid; }
+    bool better(int64_t a, int64_t b) const { return side_ == Side::Buy ? a > b : a < b; }
+
+    // Join the back of our touch
+    void post(PlacementState& s, const Touch& t) const {
+        s.resting = s.remaining > 0 && own_touch(t) != 0;
+        if (s.resting) {
+            s.price = own_touch(t);
+            s.ahead = own_size(t);
+        }
+    }
+
+    // Cross the spread for qty (out of the current slice's remaining); with no
+    // far touch nothing trades and the shares stay in remaining
+    void take(PlacementState& s, uint32_t qty, const Touch& t) const {
+        int64_t far = far_touch(t);
+        if (qty == 0 || far == 0) {
+            return;
+        }
+        record(s, qty, far, t.mid(), false);
+    }
+
+    // Slice deadline: take what is left, count what could not be taken
+    void expire(PlacementState& s, const Touch& t) const {
+        take(s, s.remaining, t);
+        s.unfilled += s.remaining;
+        s.remaining = 0;
+        s.resting = false;
+    }
+
+    // Queue bookkeeping for one book event (mid = before the event)
+    void apply(PlacementState& s, const TapeEvent& e, double mid) const {
+        if (!s.resting) {
+            return;
+        }
+        if (e.side == side_) {
+            if (e.price == s.price) {
+                if (e.kind == TapeEventKind::Execute) {
+                    if (s.ahead >= e.shares) {
+                        s.ahead -= e.shares;
+                    } else {
+                        uint32_t spill = static_cast<uint32_t>(e.shares - s.ahead);
+                        s.ahead = 0.0;
+                        record(s, std::min(spill, s.remaining), s.price, mid, true);
+                    }
+                } else if (e.kind == TapeEventKind::Cancel) {
+                    s.ahead = ahead_after_cancel(model_, s.ahead, e.level_before, e.shares);
+                }
+            } else if (e.kind == TapeEventKind::Execute && better(s.price, e.price)) {
+                record(s, s.remaining, s.price, mid, true);     // traded through our level
+            }
+        } else if (e.kind == TapeEventKind::Add && !better(e.price, s.price)) {
+            record(s, std::min(e.shares, s.remaining), s.price, mid, true);    // crossed our price
+        }
+    }
+
+    // Escalate, re-peg or (re)post after the event
+    void decide(PlacementState& s, const PlacementParams& p, const Touch& t, double elapsed) const {
+        if (s.remaining == 0) {
+            return;
+        }
+        bool escalate = elapsed >= p.escalate_at ||
+                        (p.max_queue_ratio > 0.0 && s.resting && s.ahead > p.max_queue_ratio * s.remaining);
+        if (escalate) {
+            take(s, s.remaining, t);
+            s.resting = false;
+            return;
+        }
+        int64_t own = own_touch(t);
+        if (!s.resting || (own != 0 && better(own, s.price))) {
+            post(s, t);
+        }
+    }
+};
+
+} // namespace
+
+std::vector<PlacementResult> sweep_limit_strategy(
+    const std::vector<TapeEvent>& tape,
+    const PlacementConfig& config,
+    const std::vector<PlacementParams>& params
+) {
+    if (config.num_slices == 0 || config.quantity == 0) {
+        throw std::invalid_argument("quantity and num_slices must be positive");
+    }
+    if (config.end_time <= config.start_time) {
+        throw std::invalid_argument("end_time must be after start_time");
+    }
+    std::vector<PlacementResult> results(params.size());
+    if (params.empty()) {
+        return results;
+    }
+
+    size_t n = config.num_slices;
+    double slice_len = static_cast<double>(config.end_time - config.start_time) / n;
+    auto slice_qty = [&](size_t k) {
+        return config.quantity / static_cast<uint32_t>(n) + (k < config.quantity % n ? 1u : 0u);
+    };
+
+    size_t first = std::lower_bound(tape.begin(), tape.end(), config.start_time,
+        [](const TapeEvent& e, uint64_t t) { return e.timestamp < t; }) - tape.begin();
+    Touch arrival = first > 0 ? touch_after(tape[first - 1]) : Touch{};
+    if (arrival.mid() == 0.0 && first < tape.size()) {
+        arrival = touch_after(tape[first]);
+    }
+    double arrival_mid = arrival.mid();
+    Placement placement(config.side, config.cancel_model);
+
+    parallel_for(params.size(), config.num_threads, [&](size_t, size_t begin, size_t end) {
+        std::vector<PlacementState> state(end - begin);
+        Touch touch = arrival;
+        size_t slice = n;   // none yet
+        double slice_start = 0.0;
+
+        // take whole slices [from, to) that saw no event
+        auto take_slices = [&](size_t from, size_t to) {
+            for (size_t k = from; k < to; ++k) {
+                for (PlacementState& s : state) {
+                    s.remaining += slice_qty(k);
+                    placement.expire(s, touch);
+                }
+            }
+        };
+
+        for (size_t i = first; i < tape.size() && tape[i].timestamp < config.end_time; ++i) {
+            const TapeEvent& e = tape[i];
+            double offset = static_cast<double>(e.timestamp - config.start_time);
+            size_t k = std::min(n - 1, static_cast<size_t>(offset / slice_len));
+
+            if (k != slice) {
+                // deadline of the previous slice: whatever is left crosses
+                if (slice != n) {
+                    for (PlacementState& s : state) {
+                        placement.expire(s, touch);
+                    }
+                }
+                take_slices(slice == n ? 0 : slice + 1, k);
+                for (PlacementState& s : state) {
+                    s.remaining = slice_qty(k);
+                    placement.post(s, touch);
+                }
+                slice = k;
+                slice_start = k * slice_len;
+            }
+
+            double mid = touch.mid();
+            for (PlacementState& s : state) {
+                placement.apply(s, e, mid);
+            }
+            touch = touch_after(e);
+            double elapsed = (offset - slice_start) / slice_len;
+            for (size_t p = 0; p < state.size(); ++p) {
+                placement.decide(state[p], params[begin + p], touch, elapsed);
+            }
+        }
+
+        if (slice != n) {
+            for (PlacementState& s : state) {
+                placement.expire(s, touch);
+            }
+        }
+        take_slices(slice == n ? 0 : slice + 1, n);
+
+        for (size_t p = 0; p < state.size(); ++p) {
+            const PlacementState& s = state[p];
+            PlacementResult& r = results[begin + p];
+            r.filled = s.filled;
+            r.passive_filled = s.passive_filled;
+            r.unfilled = s.unfilled;
+            if (s.filled > 0) {
+                r.avg_price = s.notional / s.filled;
+                r.spread_capture_bps = s.capture / s.filled * 10000.0;
+                if (arrival_mid > 0.0) {
+                    double sign = config.side == Side::Buy ? 1.0 : -1.0;
+                    r.slippage_bps = sign * (r.avg_price - arrival_mid) / arrival_mid * 10000.0;
+                }
+            }
+        }
+    });
+    return results;
+}
+
+} // namespace execution
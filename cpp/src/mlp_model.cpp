@@ -0,0 +1,177 @@
+#include "mlp_model.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+
+namespace execution {
+
+namespace {
+
+Activation parse_activation(const std::string& name) {
+    if (name == "linear") return Activation::Linear;
+    if (name == "relu") return Activation::Relu;
+    if (name == "tanh") return Activation::Tanh;
+    if (name == "sigmoid") return Activation::Sigmoid;
+    throw std::runtime_error("unknown activation: " + name);
+}
+
+// Activation over a whole buffer: switch once, tight loop inside
+void activate(float* v, size_t n, Activation a) {
+    switch (a) {
+        case Activation::Linear:
+            break;
+        case Activation::Relu:
+            for (size_t i = 0; i < n; ++i) v[i] = v[i] > 0.0f ? v[i] : 0.0f;
+            break;
+        case Activation::Tanh:
+            for (size_t i = 0; i < n; ++i) v[i] = std::tanh(v[i]);
+            break;
+        case Activation::Sigmoid:
+            for (size_t i = 0; i < n; ++i) v[i] = 1.0f / (1.0f + std::exp(-v[i]));
+            break;
+    }
+}
+
+} // namespace
+
+MLPModel::MLPModel(std::vector<DenseLayer> layers) : layers_(std::move(layers)) {
+    if (layers_.empty()) {
+        throw std::invalid_argument("model needs at least one layer");
+    }
+    for (size_t l = 0; l < layers_.size(); ++l) {
+        const DenseLayer& layer = layers_[l];
+        if (layer.in == 0 || layer.out == 0 || layer.in > MAX_WIDTH || layer.out > MAX_WIDTH) {
+            throw std::invalid_argument("layer width must be in [1, MAX_WIDTH]");
+        }
+        if (layer.weights.size() != layer.in * layer.out || layer.bias.size() != layer.out) {
+            throw std::invalid_argument("layer weight / bias sizes do not match its shape");
+        }
+        if (l > 0 && layers_[l - 1].out != layer.in) {
+            throw std::invalid_argument("consecutive layer shapes do not chain");
+        }
+    }
+}
+
+MLPModel MLPModel::parse(std::istream& in) {
+    std::string token;
+    if (!(in >> token) || token != "mlp") {
+        throw std::runtime_error("model file must start with 'mlp'");
+    }
+
+    std::vector<DenseLayer> layers;
+    while (in >> token) {
+        if (token != "dense") {
+            throw std::runtime_error("expected 'dense', got: " + token);
+        }
+        DenseLayer layer;
+        std::string activation;
+        if (!(in >> layer.in >> layer.out >> activation)) {
+            throw std::runtime_error("truncated layer header");
+        }
+        // Before sizing anything from the file
+        if (layer.in == 0 || layer.out == 0 || layer.in > MAX_WIDTH || layer.out > MAX_WIDTH) {
+            throw std::runtime_error("layer width must be in [1, MAX_WIDTH]");
+        }
+        layer.activation = parse_activation(activation);
+        layer.weights.resize(layer.in * layer.out);
+        layer.bias.resize(layer.out);
+        for (float& w : layer.weights) {
+            if (!(in >> w)) throw std::runtime_error("truncated weights");
+        }
+        for (float& b : layer.bias) {
+            if (!(in >> b)) throw std::runtime_error("truncated biases");
+        }
+        layers.push_back(std::move(layer));
+    }
+    return MLPModel(std::move(layers));
+}
+
+MLPModel MLPModel::load(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("cannot open model file: " + path);
+    }
+    return parse(file);
+}
+
+void MLPModel::predict(const float* x, float* out) const {
+    if (layers_.empty()) {
+        throw std::runtime_error("model has no layers");
+    }
+    float a[MAX_WIDTH];
+    float b[MAX_WIDTH];
+    std::copy(x, x + input_dim(), a);
+
+    for (const DenseLayer& layer : layers_) {
+        const float* w = layer.weights.data();
+        for (size_t o = 0; o < layer.out; ++o) {
+            const float* row = w + o * layer.in;
+            float acc = layer.bias[o];
+            for (size_t k = 0; k < layer.in; ++k) {
+                acc += row[k] * a[k];
+            }
+            b[o] = acc;
+        }
+        activate(b, layer.out, layer.activation);
+        std::copy(b, b + layer.out, a);
+    }
+    std::copy(a, a + output_dim(), out);
+}
+
+float MLPModel::predict(const float* x) const {
+    float out[MAX_WIDTH];
+    predict(x, out);
+    return out[0];
+}
+
+void MLPModel::predict_batch(const float* x, size_t n, float* out) const {
+    if (layers_.empty()) {
+        throw std::runtime_error("model has no layers");
+    }
+    constexpr size_t L = BATCH_LANES;
+    // tile activations: feature k of lane l at [k * L + l]
+    float a[MAX_WIDTH * L];
+    float b[MAX_WIDTH * L];
+    size_t in_dim = input_dim();
+    size_t out_dim = output_dim();
+
+    for (size_t r0 = 0; r0 < n; r0 += L) {
+        size_t lanes = std::min(L, n - r0);
+
+        // transpose rows into the tile, pad missing lanes with zeros
+        for (size_t k = 0; k < in_dim; ++k) {
+            for (size_t l = 0; l < L; ++l) {
+                a[k * L + l] = l < lanes ? x[(r0 + l) * in_dim + k] : 0.0f;
+            }
+        }
+
+        for (const DenseLayer& layer : layers_) {
+            const float* w = layer.weights.data();
+            for (size_t o = 0; o < layer.out; ++o) {
+                float acc[L];
+                for (size_t l = 0; l < L; ++l) acc[l] = layer.bias[o];
+                const float* row = w + o * layer.in;
+                for (size_t k = 0; k < layer.in; ++k) {
+                    float wk = row[k];
+                    const float* src = a + k * L;
+                    for (size_t l = 0; l < L; ++l) {
+                        acc[l] += wk * src[l];
+                    }
+                }
+                std::copy(acc, acc + L, b + o * L);
+            }
+            activate(b, layer.out * L, layer.activation);
+            std::copy(b, b + layer.out * L, a);
+        }
+
+        for (size_t l = 0; l < lanes; ++l) {
+            for (size_t o = 0; o < out_dim; ++o) {
+                out[(r0 + l) * out_dim + o] = a[o * L + l];
+            }
+        }
+    }
+}
+
+} // namespace execution
@@ -0,0 +1,158 @@
+#include "mlp_policy.hpp"
+#include "kernels.hpp"
+#include "parallel.hpp"
+#include "regime_analytics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace execution {
+
+namespace {
+
+void validate(const std::vector<double>& prices, const std::vector<double>& volumes, const Order& order, const MLPModel& model) {
+    if (prices.size() != volumes.size()) {
+        throw std::invalid_argument("prices and volumes must have the same length");
+    }
+    if (order.num_slices <= 0 || order.size <= 0.0) {
+        throw std::invalid_argument("need num_slices > 0 and size > 0");
+    }
+    if (model.input_dim() != POLICY_FEATURES || model.output_dim() < 1) {
+        throw std::invalid_argument("policy model must take 4 features");
+    }
+}
+
+constexpr size_t VOLUME_BASELINE = 20;
+
+// Whole history at once (backtest path)
+std::vector<double> volume_ratios(const std::vector<double>& volumes) {
+    std::vector<double> ratio = relative_volume(volumes, 1, VOLUME_BASELINE);
+    for (double& r : ratio) {
+        if (std::isnan(r)) {
+            r = 1.0;
+        }
+    }
+    return ratio;
+}
+
+// Same value for one day, from its own trailing window (single-order path)
+double volume_ratio(const std::vector<double>& volumes, size_t day) {
+    if (day + 1 < VOLUME_BASELINE) {
+        return 1.0;
+    }
+    double sum = 0.0;
+    for (size_t i = day + 1 - VOLUME_BASELINE; i <= day; ++i) {
+        sum += volumes[i] > 0.0 ? volumes[i] : 0.0;
+    }
+    double today = volumes[day] > 0.0 ? volumes[day] : 0.0;
+    return sum > 0.0 ? today / (sum / VOLUME_BASELINE) : 1.0;
+}
+
+inline void write_features(float* f, double remaining, double size, int step, int num_slices,
+                           double price, double arrival, double volume_ratio) {
+    f[0] = static_cast<float>(remaining / size);
+    f[1] = static_cast<float>(static_cast<double>(num_slices - step) / num_slices);
+    f[2] = static_cast<float>((price / arrival - 1.0) * 100.0);
+    f[3] = static_cast<float>(volume_ratio);
+}
+
+// Model output to a slice fraction: clamp passes NaN through, so a non-finite output holds
+inline double slice_fraction(float y) {
+    double x = static_cast<double>(y);
+    return std::isfinite(x) ? std::clamp(x, 0.0, 1.0) : 0.0;
+}
+
+} // namespace
+
+ExecutionResult execute_mlp_policy(
+    const std::vector<double>& prices,
+    const std::vector<double>& volumes,
+    const Order& order,
+    size_t start_idx,
+    const MLPModel& model
+) {
+    validate(prices, volumes, order, model);
+    if (start_idx + order.num_slices > prices.size()) {
+        throw std::out_of_range("not enough data after start_idx");
+    }
+
+    ExecutionResult result;
+    result.slices.reserve(order.num_slices);
+
+    double arrival = prices[start_idx];
+    double remaining = order.size;
+    float features[POLICY_FEATURES];
+    for (int j = 0; j < order.num_slices; ++j) {
+        size_t day = start_idx + j;
+        double price = prices[day];
+        double traded = remaining;
+        if (j + 1 < order.num_slices) {
+            write_features(features, remaining, order.size, j, order.num_slices, price, arrival, volume_ratio(volumes, day));
+            double fraction = slice_fraction(model.predict(features));
+            traded = fraction * remaining;
+        }
+        remaining -= traded;
+
+        double cost = traded * price;
+        result.total_cost += cost;
+        result.slices.emplace_back(j + 1, traded, price, cost);
+    }
+
+    result.benchmark_price = arrival;
+    result.avg_price = result.total_cost / order.size;
+    result.slippage_bps = slippage_bps(result.avg_price, arrival, side_sign(order.direction));
+    return result;
+}
+
+std::vector<double> mlp_policy_slippage(
+    const std::vector<double>& prices,
+    const std::vector<double>& volumes,
+    const Order& order,
+    const MLPModel& model,
+    size_t num_threads
+) {
+    validate(prices, volumes, order, model);
+
+    size_t n = static_cast<size_t>(order.num_slices);
+    size_t num_starts = prices.size() >= n ? prices.size() - n + 1 : 0;
+    std::vector<double> ratio = volume_ratios(volumes);
+    std::vector<double> slippage(num_starts);
+    double sign = side_sign(order.direction);
+    size_t out_dim = model.output_dim();
+
+    parallel_for(num_starts, num_threads, [&](size_t, size_t begin, size_t end) {
+        size_t m = end - begin;
+        std::vector<double> remaining(m, order.size);
+        std::vector<double> notional(m, 0.0);
+        std::vector<float> features(m * POLICY_FEATURES);
+        std::vector<float> out(m * out_dim);
+
+        for (size_t j = 0; j < n; ++j) {
+            bool last = j + 1 == n;
+            if (!last) {
+                // all orders of this chunk at slice j in one batch
+                for (size_t i = 0; i < m; ++i) {
+                    size_t s = begin + i;
+                    write_features(features.data() + i * POLICY_FEATURES, remaining[i], order.size,
+                                   static_cast<int>(j), order.num_slices, prices[s + j], prices[s], ratio[s + j]);
+                }
+                model.predict_batch(features.data(), m, out.data());
+            }
+            for (size_t i = 0; i < m; ++i) {
+                double fraction = last ? 1.0 : slice_fraction(out[i * out_dim]);
+                double traded = fraction * remaining[i];
+                remaining[i] -= traded;
+                notional[i] += traded * prices[begin + i + j];
+            }
+        }
+
+        for (size_t i = 0; i < m; ++i) {
+            size_t s = begin + i;
+            slippage[s] = slippage_bps(notional[i] / order.size, prices[s], sign);
+        }
+    });
+    return slippage;
+}
+
+} // namespace execution
@@ -0,0 +1,169 @@
+#include "oms.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+namespace execution {
+
+OrderManager::OrderManager(size_t max_parents, size_t max_children, size_t max_fills, const KillSwitch& kill_switch)
+    : parents_(max_parents),
+      parent_index_(max_parents),
+      children_(max_children, max_fills, 256, max_parents),
+      kill_switch_(&kill_switch) {}
+
+ParentOrder* OrderManager::new_parent(Side side, uint32_t quantity) {
+    ParentOrder* parent = parents_.allocate(next_parent_id_, side, quantity);
+    if (parent == nullptr) {
+        return nullptr;
+    }
+    ++next_parent_id_;
+    parent_index_.insert(parent->id, parent);
+    return parent;
+}
+
+ParentOrder* OrderManager::new_parent(const Order& order) {
+    // NaN fails both comparisons; negative sizes would wrap, larger ones truncate
+    if (!(order.size >= 1.0 && order.size <= static_cast<double>(UINT32_MAX))) {
+        throw std::invalid_argument("order size must be finite and in [1, 2^32 - 1] shares");
+    }
+    Side side = order.direction == "sell" ? Side::Sell : Side::Buy;
+    return new_parent(side, static_cast<uint32_t>(std::llround(order.size)));
+}
+
+ParentOrder* OrderManager::find_parent(uint64_t parent_id) {
+    ParentOrder** parent = parent_index_.find(parent_id);
+    return parent == nullptr ? nullptr : *parent;
+}
+
+uint32_t OrderManager::remaining(uint64_t parent_id) {
+    ParentOrder* parent = find_parent(parent_id);
+    return parent == nullptr ? 0 : parent->remaining();
+}
+
+ChildOrder* OrderManager::send_child(uint64_t parent_id, int64_t price, uint32_t quantity) {
+    if (kill_switch_->engaged()) {
+        ++stats_.killed_sends;
+        return nullptr;
+    }
+    ParentOrder* parent = find_parent(parent_id);
+    if (parent == nullptr || is_terminal(parent->state) || parent->cancel_requested ||
+        quantity == 0 || quantity > parent->unallocated()) {
+        return nullptr;
+    }
+    ChildOrder* child = children_.create(parent_id, parent->side, price, quantity);
+    if (child != nullptr) {
+        parent->open += quantity;
+    }
+    return child;
+}
+
+void OrderManager::child_closed(ParentOrder& parent) {
+    if (parent.cancel_requested && parent.open == 0) {
+        transition(parent.state, OrderEvent::Cancel);
+    }
+}
+
+bool OrderManager::apply(const ExecutionReport& report) {
+    ++stats_.reports;
+    ChildOrder* child = children_.find(report.child_id);
+    if (child == nullptr) {
+        ++stats_.unknown_orders;
+        return false;
+    }
+
+    OrderEvent event;
+    switch (report.type) {
+        case ReportType::Ack:    event = OrderEvent::Ack; break;
+        case ReportType::Fill:
+            if (report.quantity == 0) {
+                ++stats_.invalid_transitions;
+                return false;
+            }
+            event = report.quantity >= child->remaining() ? OrderEvent::FullFill : OrderEvent::PartialFill;
+            break;
+        case ReportType::Cancel: event = OrderEvent::Cancel; break;
+        default:                 event = OrderEvent::Reject; break;
+    }
+    if (!transition(child->state, event)) {
+        ++stats_.invalid_transitions;
+        return false;
+    }
+
+    ParentOrder& parent = **parent_index_.find(child->parent_id);
+    switch (event) {
+        case OrderEvent::Ack:
+            transition(parent.state, OrderEvent::Ack);          // first ack only; later ones are no-ops
+            break;
+        case OrderEvent::PartialFill:
+        case OrderEvent::FullFill: {
+            uint32_t quantity = std::min(report.quantity, child->remaining());
+            children_.fill(*child, quantity, report.price, report.timestamp);
+            parent.open -= quantity;
+            parent.filled += quantity;
+            parent.notional += static_cast<double>(report.price) * quantity;
+            transition(parent.state, parent.remaining() == 0 ? OrderEvent::FullFill : OrderEvent::PartialFill);
+            if (event == OrderEvent::FullFill) {
+                child_closed(parent);
+            }
+            break;
+        }
+        case OrderEvent::Cancel:
+        case OrderEvent::Reject:
+            parent.open -= child->remaining();
+            children_.cancel(*child);
+            child_closed(parent);
+            break;
+    }
+    return true;
+}
+
+int OrderManager::cancel_parent(uint64_t parent_id) {
+    ParentOrder* parent = find_parent(parent_id);
+    if (parent == nullptr || is_terminal(parent->state)) {
+        return -1;
+    }
+    parent->cancel_requested = true;
+    int open = 0;
+    if (const ChildList* list = children_.children(parent_id)) {
+        for (const ChildOrder& child : *list) {
+            open += is_terminal(child.state) ? 0 : 1;
+        }
+    }
+    child_closed(*parent);
+    return open;
+}
+
+size_t OrderManager::cancel_all(std::vector<OutboundMessage>& batch) {
+    size_t before = batch.size();
+    parents_.for_each([this](ParentOrder& parent) {
+        if (!is_terminal(parent.state)) {
+            parent.cancel_requested = true;
+            child_closed(parent);
+        }
+    });
+    children_.for_each([&batch](ChildOrder& child) {
+        if (!is_terminal(child.state) && !child.cancel_pending) {
+            child.cancel_pending = true;
+            batch.push_back(OutboundMessage{child.id, OutboundKind::Cancel});
+        }
+    });
+    return batch.size() - before;
+}
+
+bool OrderManager::release_parent(uint64_t parent_id) {
+    ParentOrder* parent = find_parent(parent_id);
+    if (parent == nullptr || !is_terminal(parent->state)) {
+        return false;
+    }
+    // The store drops the parent's list with its last child
+    while (const ChildList* list = children_.children(parent_id)) {
+        children_.release(*list->front());
+    }
+    parent_index_.erase(parent_id);
+    parents_.release(parent);
+    return true;
+}
+
+} // namespace execution
@@ -0,0 +1,101 @@
+#include "order_book.hpp"
+
+#include <algorithm>
+
+namespace execution {
+
+namespace {
+
+template <typename Levels>
+void take_from_level(Levels& levels, int64_t price, uint32_t quantity, bool last) {
+    auto it = levels.find(price);
+    if (it == levels.end()) {
+        return;
+    }
+    it->second.quantity -= quantity;
+    if (last && --it->second.num_orders == 0) {
+        levels.erase(it);
+    }
+}
+
+} // namespace
+
+void OrderBook::level_remove(Side side, int64_t price, uint32_t quantity, bool last) {
+    if (side == Side::Buy) {
+        take_from_level(bids_, price, quantity, last);
+    } else {
+        take_from_level(asks_, price, quantity, last);
+    }
+}
+
+bool OrderBook::add(uint64_t id, Side side, int64_t price, uint32_t quantity) {
+    if (!orders_.insert(id, BookOrder{side, price, quantity}).second) {
+        return false;
+    }
+    PriceLevel& level = side == Side::Buy ? bids_[price] : asks_[price];
+    level.quantity += quantity;
+    ++level.num_orders;
+    return true;
+}
+
+uint32_t OrderBook::execute(uint64_t id, uint32_t quantity) {
+    BookOrder* order = orders_.find(id);
+    if (order == nullptr) {
+        return 0;
+    }
+    uint32_t taken = std::min(quantity, order->quantity);
+    order->quantity -= taken;
+    bool last = order->quantity == 0;
+    level_remove(order->side, order->price, taken, last);
+    if (last) {
+        orders_.erase(id);
+    }
+    return taken;
+}
+
+uint32_t OrderBook::cancel(uint64_t id, uint32_t quantity) {
+    // same book effect as an execution, kept separate for readability at call sites
+    return execute(id, quantity);
+}
+
+bool OrderBook::remove(uint64_t id) {
+    const BookOrder* order = orders_.find(id);
+    if (order == nullptr) {
+        return false;
+    }
+    level_remove(order->side, order->price, order->quantity, true);
+    orders_.erase(id);
+    return true;
+}
+
+bool OrderBook::replace(uint64_t old_id, uint64_t new_id, int64_t price, uint32_t quantity) {
+    // validate both ids up front so a rejected replace leaves the book untouched
+    const BookOrder* old_order = find(old_id);
+    if (old_order == nullptr || old_id == new_id || find(new_id) != nullptr) {
+        return false;
+    }
+    Side side = old_order->side;
+    remove(old_id);
+    return add(new_id, side, price, quantity);
+}
+
+void OrderBook::clear() {
+    orders_.clear();
+    bids_.clear();
+    asks_.clear();
+}
+
+const BookOrder* OrderBook::find(uint64_t id) const {
+    return orders_.find(id);
+}
+
+PriceLevel OrderBook::level(Side side, int64_t price) const {
+    if (side == Side::Buy) {
+        auto it = bids_.find(price);
+        return it == bids_.end() ? PriceLevel{} : it->second;
+    }
+    auto it = asks_.find(price);
+    return it == asks_.end() ? PriceLevel{} : it->second;
+}
+
+} // namespace execution
@@ -0,0 +1,196 @@
+#include "quantile_sketch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace execution {
+
+QuantileSketch::QuantileSketch(size_t k, uint64_t seed)
+    : k_(std::max<size_t>(k, 8)),
+      rng_state_(seed ? seed : 1),
+      levels_(1),
+      num_retained_(0),
+      max_retained_(0),
+      count_(0),
+      min_(std::numeric_limits<double>::quiet_NaN()),
+      max_(std::numeric_limits<double>::quiet_NaN()) {
+    max_retained_ = total_capacity();
+}
+
+// Top level holds k items, each level below 2/3 of the one above (min 2)
+size_t QuantileSketch::level_capacity(size_t level) const {
+    size_t depth = levels_.size() - 1 - level;
+    double cap = std::ceil(static_cast<double>(k_) * std::pow(2.0 / 3.0, static_cast<double>(depth)));
+    return std::max<size_t>(2, static_cast<size_t>(cap));
+}
+
+size_t QuantileSketch::total_capacity() const {
+    size_t total = 0;
+    for (size_t h = 0; h < levels_.size(); ++h) {
+        total += level_capacity(h);
+    }
+    return total;
+}
+
+bool QuantileSketch::random_bit() {
+    rng_state_ ^= rng_state_ << 13;
+    rng_state_ ^= rng_state_ >> 7;
+    rng_state_ ^= rng_state_ << 17;
+    return rng_state_ & 1;
+}
+
+// Compact the lowest full level: sort it, promote every other item one level up
+void QuantileSketch::compress() {
+    for (size_t h = 0; h < levels_.size(); ++h) {
+        if (levels_[h].size() < level_capacity(h)) {
+            continue;
+        }
+        if (h + 1 == levels_.size()) {
+            levels_.emplace_back();
+        }
+
+        std::vector<double>& level = levels_[h];
+        std::vector<double>& above = levels_[h + 1];
+        std::sort(level.begin(), level.end());
+
+        // odd count: first item stays behind so total weight is preserved
+        size_t start = level.size() % 2;
+        size_t offset = random_bit() ? 1 : 0;
+        for (size_t i = start + offset; i < level.size(); i += 2) {
+            above.push_back(level[i]);
+        }
+        num_retained_ -= (level.size() - start) / 2;
+        level.resize(start);
+        break;
+    }
+    max_retained_ = total_capacity();
+}
+
+void QuantileSketch::update(double value) {
+    if (std::isnan(value)) {
+        return;
+    }
+    if (count_ == 0) {
+        min_ = value;
+        max_ = value;
+    } else {
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+    }
+    ++count_;
+
+    levels_[0].push_back(value);
+    ++num_retained_;
+    if (num_retained_ >= max_retained_) {
+        compress();
+    }
+}
+
+void QuantileSketch::update(const std::vector<double>& values) {
+    for (double v : values) {
+        update(v);
+    }
+}
+
+void QuantileSketch::merge(const QuantileSketch& other) {
+    if (other.empty()) {
+        return;
+    }
+    if (&other == this) {
+        // levels_ grows while it is read below
+        QuantileSketch copy(other);
+        merge(copy);
+        return;
+    }
+    if (empty()) {
+        min_ = other.min_;
+        max_ = other.max_;
+    } else {
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+    }
+    count_ += other.count_;
+
+    if (levels_.size() < other.levels_.size()) {
+        levels_.resize(other.levels_.size());
+    }
+    for (size_t h = 0; h < other.levels_.size(); ++h) {
+        levels_[h].insert(levels_[h].end(), other.levels_[h].begin(), other.levels_[h].end());
+    }
+    num_retained_ += other.num_retained_;
+
+    max_retained_ = total_capacity();
+    while (num_retained_ >= max_retained_) {
+        compress();
+    }
+}
+
+std::vector<std::pair<double, uint64_t>> QuantileSketch::sorted_view() const {
+    std::vector<std::pair<double, uint64_t>> view;
+    view.reserve(num_retained_);
+    for (size_t h = 0; h < levels_.size(); ++h) {
+        uint64_t weight = uint64_t{1} << h;
+        for (double v : levels_[h]) {
+            view.emplace_back(v, weight);
+        }
+    }
+    std::sort(view.begin(), view.end());
+    return view;
+}
+
+double QuantileSketch::quantile(double q) const {
+    return quantiles({q})[0];
+}
+
+// One sort of the retained items serves every requested quantile
+std::vector<double> QuantileSketch::quantiles(const std::vector<double>& qs) const {
+    std::vector<double> out(qs.size(), std::numeric_limits<double>::quiet_NaN());
+    if (empty()) {
+        return out;
+    }
+
+    auto view = sorted_view();
+    std::vector<uint64_t> cumulative(view.size());
+    uint64_t running = 0;
+    for (size_t i = 0; i < view.size(); ++i) {
+        running += view[i].second;
+        cumulative[i] = running;
+    }
+
+    for (size_t j = 0; j < qs.size(); ++j) {
+        double q = qs[j];
+        if (q <= 0.0) {
+            out[j] = min_;
+            continue;
+        }
+        if (q >= 1.0) {
+            out[j] = max_;
+            continue;
+        }
+        double target = q * static_cast<double>(count_);
+        auto it = std::lower_bound(cumulative.begin(), cumulative.end(), target,
+            [](uint64_t cum, double t) { return static_cast<double>(cum) < t; });
+        size_t idx = std::min<size_t>(it - cumulative.begin(), view.size() - 1);
+        out[j] = view[idx].first;
+    }
+    return out;
+}
+
+double QuantileSketch::rank(double value) const {
+    if (empty()) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    uint64_t below = 0;
+    for (size_t h = 0; h < levels_.size(); ++h) {
+        uint64_t weight = uint64_t{1} << h;
+        for (double v : levels_[h]) {
+            if (v <= value) {
+                below += weight;
+            }
+        }
+    }
+    return static_cast<double>(below) / static_cast<double>(count_);
+}
+
+} // namespace execution
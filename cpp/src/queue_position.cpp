@@ -0,0 +1,173 @@
+#include "queue_position.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace execution {
+
+QueueTracker::QueueTracker(uint16_t locate, CancelModel model)
+    : locate_(locate), model_(model) {}
+
+PassiveOrder* QueueTracker::own_at(Side side, int64_t price) {
+    auto& lv = levels(side);
+    auto it = lv.find(price);
+    return it == lv.end() ? nullptr : &own_[it->second];
+}
+
+void QueueTracker::fill(PassiveOrder& order, uint32_t quantity, uint64_t timestamp) {
+    quantity = std::min(quantity, order.remaining());
+    if (quantity == 0) {
+        return;
+    }
+    order.filled += quantity;
+    fills_.push_back(QueueFill{order.id, timestamp, order.price, quantity});
+    if (order.remaining() == 0) {
+        deactivate(order);
+    }
+}
+
+void QueueTracker::deactivate(PassiveOrder& order) {
+    order.active = false;
+    levels(order.side).erase(order.price);
+    size_t index = order.id - 1;
+    auto it = std::find(active_.begin(), active_.end(), index);
+    if (it != active_.end()) {
+        *it = active_.back();
+        active_.pop_back();
+    }
+}
+
+uint64_t QueueTracker::post(Side side, int64_t price, uint32_t quantity) {
+    if (quantity == 0 || price <= 0) {
+        throw std::invalid_argument("passive order needs a positive price and quantity");
+    }
+    int64_t opposite = side == Side::Buy ? book_.best_ask() : book_.best_bid();
+    if (opposite != 0 && (side == Side::Buy ? price >= opposite : price <= opposite)) {
+        throw std::invalid_argument("passive order would cross the book");
+    }
+    if (own_at(side, price) != nullptr) {
+        throw std::invalid_argument("an own order already rests at this level");
+    }
+
+    uint64_t id = own_.size() + 1;
+    PassiveOrder order{id, side, price, quantity};
+    order.ahead = static_cast<double>(book_.level(side, price).quantity);
+    own_.push_back(order);
+    levels(side)[price] = id - 1;
+    active_.push_back(id - 1);
+    return id;
+}
+
+bool QueueTracker::cancel(uint64_t id) {
+    if (id == 0 || id > own_.size() || !own_[id - 1].active) {
+        return false;
+    }
+    deactivate(own_[id - 1]);
+    return true;
+}
+
+void QueueTracker::on_level_execute(Side side, int64_t price, uint32_t shares, uint64_t timestamp) {
+    PassiveOrder* own = own_at(side, price);
+    if (own == nullptr) {
+        return;
+    }
+    if (own->ahead >= shares) {
+        own->ahead -= shares;
+        return;
+    }
+    double spill = shares - own->ahead;
+    own->ahead = 0.0;
+    fill(*own, static_cast<uint32_t>(spill), timestamp);
+}
+
+void QueueTracker::on_level_cancel(Side side, int64_t price, uint32_t shares) {
+    PassiveOrder* own = own_at(side, price);
+    if (own == nullptr) {
+        return;
+    }
+    double level = static_cast<double>(book_.level(side, price).quantity);   // before the cancel
+    own->ahead = ahead_after_cancel(model_, own->ahead, level, shares);
+}
+
+void QueueTracker::on_add(const ItchAdd& m) {
+    if (m.locate != locate_) {
+        return;
+    }
+    // an opposite order at or through our price would have traded with us first
+    uint32_t shares = m.shares;
+    for (size_t i = active_.size(); i-- > 0 && shares > 0;) {
+        PassiveOrder& own = own_[active_[i]];
+        bool crossed = own.side == Side::Buy ? (m.side == Side::Sell && m.price <= own.price)
+                                             : (m.side == Side::Buy && m.price >= own.price);
+        if (crossed) {
+            uint32_t take = std::min(shares, own.remaining());
+            fill(own, take, m.timestamp);
+            shares -= take;
+        }
+    }
+    book_.add(m.order_ref, m.side, m.price, m.shares);
+}
+
+void QueueTracker::on_execute(const ItchExecute& m) {
+    if (m.locate != locate_) {
+        return;
+    }
+    const BookOrder* resting = book_.find(m.order_ref);
+    if (resting == nullptr) {
+        return;
+    }
+    Side side = resting->side;
+    int64_t price = resting->price;
+    on_level_execute(side, price, m.shares, m.timestamp);
+
+    // executions below our bid (above our offer) went through our level
+    for (size_t i = active_.size(); i-- > 0;) {
+        PassiveOrder& own = own_[active_[i]];
+        if (own.side == side && (side == Side::Buy ? price < own.price : price > own.price)) {
+            fill(own, own.remaining(), m.timestamp);
+        }
+    }
+    book_.execute(m.order_ref, m.shares);
+}
+
+void QueueTracker::on_cancel(const ItchCancel& m) {
+    if (m.locate != locate_) {
+        return;
+    }
+    const BookOrder* resting = book_.find(m.order_ref);
+    if (resting == nullptr) {
+        return;
+    }
+    on_level_cancel(resting->side, resting->price, std::min(m.shares, resting->quantity));
+    book_.cancel(m.order_ref, m.shares);
+}
+
+void QueueTracker::on_delete(const ItchDelete& m) {
+    if (m.locate != locate_) {
+        return;
+    }
+    const BookOrder* resting = book_.find(m.order_ref);
+    if (resting == nullptr) {
+        return;
+    }
+    on_level_cancel(resting->side, resting->price, resting->quantity);
+    book_.remove(m.order_ref);
+}
+
+void QueueTracker::on_replace(const ItchReplace& m) {
+    if (m.locate != locate_) {
+        return;
+    }
+    // same checks as OrderBook::replace, before any queue estimate moves
+    const BookOrder* resting = book_.find(m.original_ref);
+    if (resting == nullptr || m.new_ref == m.original_ref || book_.find(m.new_ref) != nullptr) {
+        return;
+    }
+    Side side = resting->side;
+    on_level_cancel(side, resting->price, resting->quantity);
+    book_.remove(m.original_ref);
+    // the new order goes through the add path (joins behind, may cross us)
+    on_add(ItchAdd{m.locate, m.timestamp, m.new_ref, side, m.shares, m.price, {}});
+}
+
+} // namespace execution
@@ -0,0 +1,83 @@
+#include "rate_throttle.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace execution {
+
+double TscClock::ticks_per_second() {
+    static const double rate = [] {
+#if defined(__x86_64__) || defined(__i386__)
+        auto t0 = std::chrono::steady_clock::now();
+        uint64_t c0 = now();
+        auto t1 = t0;
+        while (t1 - t0 < std::chrono::milliseconds(20)) {
+            t1 = std::chrono::steady_clock::now();
+        }
+        uint64_t c1 = now();
+        return static_cast<double>(c1 - c0) / std::chrono::duration<double>(t1 - t0).count();
+#else
+        return 1e9;
+#endif
+    }();
+    return rate;
+}
+
+RateThrottle::RateThrottle(double rate, uint32_t burst, double ticks_per_second)
+    : ticks_per_second_(ticks_per_second) {
+    if (!(rate > 0.0) || burst == 0) {
+        throw std::invalid_argument("rate must be positive and burst at least 1");
+    }
+    interval_ = std::max<uint64_t>(1, static_cast<uint64_t>(std::llround(ticks_per_second / rate)));
+    window_ = burst * interval_;
+}
+
+void CoalescingQueue::trim() {
+    while (!pending_.empty() && !pending_.front().live) {
+        pending_.pop_front();
+        ++head_seq_;
+    }
+}
+
+void CoalescingQueue::push(const OutboundMessage& message) {
+    if (uint64_t* seq = by_child_.find(message.child_id)) {
+        OutboundMessage& pending = pending_[*seq - head_seq_].message;
+        ++stats_.coalesced;
+        if (pending.kind == OutboundKind::Cancel) {
+            return;
+        }
+        if (message.kind == OutboundKind::Cancel && pending.kind == OutboundKind::New) {
+            pending_[*seq - head_seq_].live = false;
+            by_child_.erase(message.child_id);
+            --live_;
+            ++stats_.dropped;
+            trim();
+            return;
+        }
+        if (message.kind == OutboundKind::Amend) {
+            pending.price = message.price;
+            pending.quantity = message.quantity;
+        } else {
+            pending = message;
+        }
+        return;
+    }
+    by_child_.insert(message.child_id, head_seq_ + pending_.size());
+    pending_.push_back(Slot{message, true});
+    ++live_;
+    ++stats_.queued;
+}
+
+void CoalescingQueue::pop() {
+    if (live_ == 0) {
+        return;
+    }
+    by_child_.erase(pending_.front().message.child_id);
+    pending_.pop_front();
+    ++head_seq_;
+    --live_;
+    trim();
+}
+
+} // namespace execution
@@ -0,0 +1,243 @@
+#include "regime_analytics.hpp"
+#include "kernels.hpp"
+#include "moments.hpp"
+#include "parallel.hpp"
+#include "quantile_sketch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace execution {
+
+namespace {
+
+constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+// Per-thread, per-bucket reducer
+struct BucketAccumulator {
+    uint64_t count = 0;
+    RunningMoments twap;
+    RunningMoments vwap;
+    QuantileSketch twap_sketch;
+    QuantileSketch vwap_sketch;
+
+    BucketAccumulator(uint64_t seed) : twap_sketch(QuantileSketch::DEFAULT_K, seed), vwap_sketch(QuantileSketch::DEFAULT_K, seed + 1) {}
+
+    void add(double twap_bps, double vwap_bps) {
+        ++count;
+        twap.add(twap_bps);
+        vwap.add(vwap_bps);
+        twap_sketch.update(twap_bps);
+        vwap_sketch.update(vwap_bps);
+    }
+
+    void merge(const BucketAccumulator& other) {
+        count += other.count;
+        twap.merge(other.twap);
+        vwap.merge(other.vwap);
+        twap_sketch.merge(other.twap_sketch);
+        vwap_sketch.merge(other.vwap_sketch);
+    }
+};
+
+} // namespace
+
+std::vector<double> rolling_volatility(const std::vector<double>& prices, size_t window) {
+    std::vector<double> vol(prices.size(), NaN);
+    if (window < 2 || prices.size() <= window) {
+        return vol;
+    }
+
+    std::vector<double> returns(prices.size(), 0.0);
+    for (size_t i = 1; i < prices.size(); ++i) {
+        returns[i] = std::log(prices[i] / prices[i - 1]);
+    }
+
+    // running sums over returns (i - window, i]; a zero / non-finite price
+    // gives a non-finite return, which restarts the sums instead of poisoning them
+    double sum = 0.0;
+    double sq = 0.0;
+    size_t run = 0;     // finite returns ending at i
+    for (size_t i = 1; i < prices.size(); ++i) {
+        if (!std::isfinite(returns[i])) {
+            sum = 0.0;
+            sq = 0.0;
+            run = 0;
+            continue;
+        }
+        sum += returns[i];
+        sq += returns[i] * returns[i];
+        if (++run > window) {
+            sum -= returns[i - window];
+            sq -= returns[i - window] * returns[i - window];
+        }
+        if (run >= window) {
+            double mean = sum / window;
+            double var = (sq - window * mean * mean) / (window - 1);
+            vol[i] = var > 0.0 ? std::sqrt(var) : 0.0;
+        }
+    }
+    return vol;
+}
+
+std::vector<double> relative_volume(const std::vector<double>& volumes, size_t window, size_t baseline) {
+    std::vector<double> ratio(volumes.size(), NaN);
+    if (window == 0 || baseline < window) {
+        return ratio;
+    }
+
+    std::vector<double> prefix(volumes.size() + 1, 0.0);
+    for (size_t i = 0; i < volumes.size(); ++i) {
+        double v = volumes[i] > 0.0 ? volumes[i] : 0.0;
+        prefix[i + 1] = prefix[i] + v;
+    }
+
+    for (size_t i = baseline - 1; i < volumes.size(); ++i) {
+        double recent = (prefix[i + 1] - prefix[i + 1 - window]) / window;
+        double longer = (prefix[i + 1] - prefix[i + 1 - baseline]) / baseline;
+        if (longer > 0.0) {
+            ratio[i] = recent / longer;
+        }
+    }
+    return ratio;
+}
+
+std::vector<int> quantile_labels(const std::vector<double>& values, size_t num_buckets, std::vector<double>& edges) {
+    std::vector<int> labels(values.size(), -1);
+    edges.clear();
+    if (num_buckets == 0) {
+        return labels;
+    }
+
+    std::vector<double> valid;
+    valid.reserve(values.size());
+    for (double v : values) {
+        if (!std::isnan(v)) {
+            valid.push_back(v);
+        }
+    }
+    if (valid.empty()) {
+        return labels;
+    }
+
+    std::sort(valid.begin(), valid.end());
+    for (size_t b = 1; b < num_buckets; ++b) {
+        edges.push_back(valid[b * valid.size() / num_buckets]);
+    }
+
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (!std::isnan(values[i])) {
+            labels[i] = static_cast<int>(std::upper_bound(edges.begin(), edges.end(), values[i]) - edges.begin());
+        }
+    }
+    return labels;
+}
+
+RegimeReport regime_backtest(
+    const std::vector<double>& prices,
+    const std::vector<double>& volumes,
+    const Order& order,
+    const RegimeConfig& config
+) {
+    if (prices.size() != volumes.size()) {
+        throw std::invalid_argument("prices and volumes must have the same length");
+    }
+    if (order.num_slices <= 0) {
+        throw std::invalid_argument("num_slices must be positive");
+    }
+    if (config.num_vol_buckets == 0 || config.num_volume_buckets == 0) {
+        throw std::invalid_argument("bucket counts must be positive");
+    }
+
+    RegimeReport report;
+    report.num_skipped = 0;
+
+    size_t num_slices = static_cast<size_t>(order.num_slices);
+    size_t num_starts = prices.size() >= num_slices ? prices.size() - num_slices + 1 : 0;
+
+    // Features from trailing data only; the edges are cut over the whole history
+    std::vector<int> vol_labels = quantile_labels(
+        rolling_volatility(prices, config.vol_window), config.num_vol_buckets, report.vol_edges);
+    std::vector<int> volume_labels = quantile_labels(
+        relative_volume(volumes, config.volume_window, config.volume_baseline), config.num_volume_buckets, report.volume_edges);
+    vol_labels.resize(num_starts);
+    volume_labels.resize(num_starts);
+
+    size_t num_buckets = config.num_vol_buckets * config.num_volume_buckets;
+    double sign = side_sign(order.direction);
+
+    // One reducer set per worker, merged after the pass
+    size_t max_workers = resolve_num_threads(config.num_threads);
+    std::vector<std::vector<BucketAccumulator>> partials(max_workers);
+    std::vector<uint64_t> skipped(max_workers, 0);
+    for (size_t t = 0; t < max_workers; ++t) {
+        partials[t].reserve(num_buckets);
+        for (size_t b = 0; b < num_buckets; ++b) {
+            partials[t].emplace_back(2 * (t * num_buckets + b) + 1);
+        }
+    }
+
+    // Fixed-N kernels for the common slice counts (see dispatch_slice_count)
+    dispatch_slice_count(num_slices, [&](auto fixed) {
+        constexpr size_t N = decltype(fixed)::value;
+        parallel_for(num_starts, config.num_threads, [&](size_t tid, size_t begin, size_t end) {
+            auto& local = partials[tid];
+            for (size_t s = begin; s < end; ++s) {
+                if (vol_labels[s] < 0 || volume_labels[s] < 0) {
+                    ++skipped[tid];
+                    continue;
+                }
+                const double* p = prices.data() + s;
+                const double* v = volumes.data() + s;
+                double benchmark = p[0];
+                double twap = slippage_bps(twap_avg_price<N>(p, num_slices), benchmark, sign);
+                double vwap = slippage_bps(vwap_avg_price<N>(p, v, num_slices), benchmark, sign);
+
+                size_t bucket = vol_labels[s] * config.num_volume_buckets + volume_labels[s];
+                local[bucket].add(twap, vwap);
+            }
+        });
+    });
+
+    // Reduce
+    std::vector<BucketAccumulator> totals = std::move(partials[0]);
+    for (size_t t = 1; t < max_workers; ++t) {
+        for (size_t b = 0; b < num_buckets; ++b) {
+            totals[b].merge(partials[t][b]);
+        }
+    }
+    for (uint64_t s : skipped) {
+        report.num_skipped += s;
+    }
+
+    report.buckets.resize(num_buckets);
+    for (size_t b = 0; b < num_buckets; ++b) {
+        const BucketAccumulator& acc = totals[b];
+        RegimeBucket& out = report.buckets[b];
+        out.vol_bucket = b / config.num_volume_buckets;
+        out.volume_bucket = b % config.num_volume_buckets;
+        out.count = acc.count;
+        if (acc.count == 0) {
+            continue;
+        }
+
+        auto twap_tails = acc.twap_sketch.quantiles({0.05, 0.95});
+        auto vwap_tails = acc.vwap_sketch.quantiles({0.05, 0.95});
+        out.twap_mean_bps = acc.twap.mean;
+        out.twap_std_bps = acc.twap.sample_std();
+        out.twap_p5_bps = twap_tails[0];
+        out.twap_p95_bps = twap_tails[1];
+        out.vwap_mean_bps = acc.vwap.mean;
+        out.vwap_std_bps = acc.vwap.sample_std();
+        out.vwap_p5_bps = vwap_tails[0];
+        out.vwap_p95_bps = vwap_tails[1];
+    }
+
+    report.vol_labels = std::move(vol_labels);
+    report.volume_labels = std::move(volume_labels);
+    return report;
+}
+
+} // namespace execution
@@ -0,0 +1,174 @@
+#include "session_calendar.hpp"
+#include "parallel.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace execution {
+
+int64_t days_from_civil(int32_t date) {
+    int64_t y = date / 10000;
+    int64_t m = (date / 100) % 100;
+    int64_t d = date % 100;
+    y -= m <= 2;
+    int64_t era = (y >= 0 ? y : y - 399) / 400;
+    int64_t yoe = y - era * 400;
+    int64_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+namespace {
+
+int32_t civil_from_days(int64_t z) {
+    z += 719468;
+    int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    int64_t doe = z - era * 146097;
+    int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    int64_t mp = (5 * doy + 2) / 153;
+    int64_t d = doy - (153 * mp + 2) / 5 + 1;
+    int64_t m = mp + (mp < 10 ? 3 : -9);
+    int64_t y = yoe + era * 400 + (m <= 2);
+    return static_cast<int32_t>(y * 10000 + m * 100 + d);
+}
+
+bool contains(const std::vector<int32_t>& sorted, int32_t date) {
+    return std::binary_search(sorted.begin(), sorted.end(), date);
+}
+
+uint32_t slices_in(uint32_t minutes, uint32_t slice_minutes) {
+    return std::max<uint32_t>(1, minutes / slice_minutes);
+}
+
+// First session of an order and the minute it starts trading there
+struct OrderStart {
+    size_t session;
+    uint16_t open;
+};
+
+OrderStart order_start(const SessionCalendar& calendar, const MultiDayOrder& order) {
+    size_t s = calendar.index_of(order.start_date);
+    if (s < calendar.size() && calendar[s].date == order.start_date && order.start_minute > calendar[s].open_minute) {
+        if (order.start_minute >= calendar[s].close_minute) {
+            ++s;            // after the close: start at the next open
+        } else {
+            return {s, order.start_minute};
+        }
+    }
+    return {s, s < calendar.size() ? calendar[s].open_minute : uint16_t{0}};
+}
+
+} // namespace
+
+int day_of_week(int32_t date) {
+    int64_t days = days_from_civil(date);
+    // 1970-01-01 was a Thursday
+    return static_cast<int>(((days % 7) + 7 + 3) % 7);
+}
+
+SessionCalendar::SessionCalendar(std::vector<Session> sessions) : sessions_(std::move(sessions)) {
+    minute_offsets_.reserve(sessions_.size() + 1);
+    minute_offsets_.push_back(0);
+    for (size_t i = 0; i < sessions_.size(); ++i) {
+        const Session& s = sessions_[i];
+        if (s.close_minute <= s.open_minute || s.close_minute > 24 * 60) {
+            throw std::invalid_argument("session must open before it closes");
+        }
+        if (i > 0 && s.date <= sessions_[i - 1].date) {
+            throw std::invalid_argument("sessions must be in strictly increasing date order");
+        }
+        minute_offsets_.push_back(minute_offsets_.back() + s.minutes());
+    }
+}
+
+SessionCalendar SessionCalendar::weekdays(int32_t first_date, int32_t last_date,
+                                          const std::vector<int32_t>& holidays,
+                                          const std::vector<int32_t>& half_days,
+                                          uint16_t open_minute, uint16_t close_minute,
+                                          uint16_t half_day_close) {
+    std::vector<int32_t> off(holidays);
+    std::vector<int32_t> half(half_days);
+    std::sort(off.begin(), off.end());
+    std::sort(half.begin(), half.end());
+
+    std::vector<Session> sessions;
+    int64_t last = days_from_civil(last_date);
+    for (int64_t day = days_from_civil(first_date); day <= last; ++day) {
+        int32_t date = civil_from_days(day);
+        if (day_of_week(date) >= 5 || contains(off, date)) {
+            continue;
+        }
+        sessions.push_back(Session{date, open_minute, contains(half, date) ? half_day_close : close_minute});
+    }
+    return SessionCalendar(std::move(sessions));
+}
+
+size_t SessionCalendar::index_of(int32_t date) const {
+    auto it = std::lower_bound(sessions_.begin(), sessions_.end(), date,
+                               [](const Session& s, int32_t d) { return s.date < d; });
+    return static_cast<size_t>(it - sessions_.begin());
+}
+
+Schedule build_schedules(const SessionCalendar& calendar, const std::vector<MultiDayOrder>& orders,
+                         const ScheduleConfig& config) {
+    if (config.slice_minutes == 0) {
+        throw std::invalid_argument("slice_minutes must be positive");
+    }
+    const uint32_t step = config.slice_minutes;
+
+    // Full-session slice counts, prefix-summed once for every order
+    std::vector<uint64_t> slice_offsets(calendar.size() + 1, 0);
+    for (size_t s = 0; s < calendar.size(); ++s) {
+        slice_offsets[s + 1] = slice_offsets[s] + slices_in(calendar[s].minutes(), step);
+    }
+
+    Schedule out;
+    out.order_offsets.assign(orders.size() + 1, 0);
+    for (size_t i = 0; i < orders.size(); ++i) {
+        OrderStart start = order_start(calendar, orders[i]);
+        size_t count = 0;
+        if (start.session < calendar.size() && orders[i].num_sessions > 0) {
+            size_t end = std::min(calendar.size(), start.session + orders[i].num_sessions);
+            count = slices_in(calendar[start.session].close_minute - start.open, step) +
+                    (slice_offsets[end] - slice_offsets[start.session + 1]);
+        }
+        out.order_offsets[i + 1] = out.order_offsets[i] + count;
+    }
+
+    size_t total = out.order_offsets.back();
+    out.session.resize(total);
+    out.minute.resize(total);
+    out.quantity.resize(total);
+
+    parallel_for(orders.size(), config.num_threads, [&](size_t, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const MultiDayOrder& order = orders[i];
+            size_t pos = out.order_offsets[i];
+            if (pos == out.order_offsets[i + 1]) {
+                continue;
+            }
+            OrderStart start = order_start(calendar, order);
+            size_t last = std::min(calendar.size(), start.session + order.num_sessions);
+            uint32_t first_minutes = calendar[start.session].close_minute - start.open;
+            double total_minutes = static_cast<double>(first_minutes + calendar.minutes_between(start.session + 1, last));
+            double num_sessions = static_cast<double>(last - start.session);
+
+            for (size_t s = start.session; s < last; ++s) {
+                uint16_t open = s == start.session ? start.open : calendar[s].open_minute;
+                uint32_t minutes = calendar[s].close_minute - open;
+                double share = config.budget == SessionBudget::ByMinutes ? minutes / total_minutes : 1.0 / num_sessions;
+                uint32_t k = slices_in(minutes, step);
+                double slice_quantity = order.quantity * share / k;
+                for (uint32_t j = 0; j < k; ++j, ++pos) {
+                    out.session[pos] = static_cast<uint32_t>(s);
+                    out.minute[pos] = static_cast<uint16_t>(open + j * step);
+                    out.quantity[pos] = slice_quantity;
+                }
+            }
+        }
+    });
+    return out;
+}
+
+} // namespace execution
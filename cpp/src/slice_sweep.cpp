@@ -0,0 +1,248 @@
+#include "slice_sweep.hpp"
+#include "kernels.hpp"
+#include "moments.hpp"
+#include "parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace execution {
+
+namespace {
+
+size_t num_starts_for(size_t n, const std::vector<size_t>& slice_counts) {
+    size_t min_k = *std::min_element(slice_counts.begin(), slice_counts.end());
+    return n >= min_k ? n - min_k + 1 : 0;
+}
+
+void validate(const std::vector<double>& prices, const std::vector<double>& volumes, const SweepConfig& config) {
+    if (prices.size() != volumes.size()) {
+        throw std::invalid_argument("prices and volumes must have the same length");
+    }
+    if (config.slice_counts.empty()) {
+        throw std::invalid_argument("slice_counts must not be empty");
+    }
+    for (size_t k : config.slice_counts) {
+        if (k == 0) {
+            throw std::invalid_argument("num_slices must be positive");
+        }
+    }
+    // The running sums would carry one bad value into every later window
+    for (size_t i = 0; i < prices.size(); ++i) {
+        if (!std::isfinite(prices[i]) || std::isinf(volumes[i])) {
+            throw std::invalid_argument("prices must be finite and volumes not infinite (row " + std::to_string(i) + ")");
+        }
+    }
+}
+
+// Starts evaluated per kernel call: the row buffers stay in L1
+constexpr size_t ROW_CHUNK = 512;
+
+// Windows are re-seeded this often (a multiple of ROW_CHUNK) to bound running-sum drift
+constexpr size_t RESEED_EVERY = 8 * ROW_CHUNK;
+
+// Sliding window sums of one slice count
+struct Window {
+    double sum_p = 0.0;
+    double sum_pv = 0.0;
+    double sum_v = 0.0;
+    size_t with_volume = 0;
+};
+
+inline double clean_volume(double vol) {
+    return vol > 0.0 ? vol : 0.0;
+}
+
+Window seed_window(const double* p, const double* v, size_t begin, size_t k) {
+    Window w;
+    for (size_t i = begin; i < begin + k; ++i) {
+        double vol = clean_volume(v[i]);
+        w.sum_p += p[i];
+        w.sum_pv += p[i] * vol;
+        w.sum_v += vol;
+        w.with_volume += vol > 0.0;
+    }
+    return w;
+}
+
+/**
+ * Slippage of starts [first, last) for slice count k; w holds the window at
+ * first (seeded at seeded_at) and is left at last - 1.
+ * slippage_bps(avg, p[s], sign) == avg * scale[s] - base, scale = sign * 1e4 / p[s]
+ */
+void slide(const double* p, const double* v, const double* scale, double base, size_t k, size_t seeded_at,
+           size_t first, size_t last, Window& w, double* twap_row, double* vwap_row) {
+    double inv_k = 1.0 / static_cast<double>(k);
+    for (size_t s = first; s < last; ++s) {
+        if (s > seeded_at) {
+            double out_vol = clean_volume(v[s - 1]);
+            double in_vol = clean_volume(v[s + k - 1]);
+            w.sum_p += p[s + k - 1] - p[s - 1];
+            w.sum_pv += p[s + k - 1] * in_vol - p[s - 1] * out_vol;
+            w.sum_v += in_vol - out_vol;
+            w.with_volume += in_vol > 0.0;
+            w.with_volume -= out_vol > 0.0;
+        }
+        double twap = w.sum_p * inv_k;
+        double vwap = w.with_volume > 0 ? w.sum_pv / w.sum_v : twap;
+        twap_row[s - first] = twap * scale[s - first] - base;
+        vwap_row[s - first] = vwap * scale[s - first] - base;
+    }
+}
+
+/**
+ * Traversal shared by the grid and the stats reduction
+ * row(tid, k_index, first_start, count, twap_bps, vwap_bps) for consecutive
+ * runs of valid starts of one slice count
+ *
+ * Tiled: tile -> row chunk -> slice count, so a chunk's prices and scales are
+ * reused by every slice count while in L1. Untiled (block_size 0): slice count
+ * -> row chunk over the worker's whole range. Either way windows are re-seeded
+ * every RESEED_EVERY starts.
+ */
+template <typename Row>
+void sweep_tiles(const std::vector<double>& prices, const std::vector<double>& volumes,
+                 const SweepConfig& config, size_t num_starts, Row&& row) {
+    const double* p = prices.data();
+    const double* v = volumes.data();
+    const size_t n = prices.size();
+    const double base = side_sign(config.direction) * 10000.0;
+    const size_t num_k = config.slice_counts.size();
+    const bool tiled = config.block_size > 0;
+
+    size_t workers = resolve_num_threads(config.num_threads);
+    size_t block = tiled ? config.block_size : std::max<size_t>(1, (num_starts + workers - 1) / workers);
+    size_t num_tiles = (num_starts + block - 1) / block;
+
+    parallel_for(num_tiles, config.num_threads, [&](size_t tid, size_t first_tile, size_t last_tile) {
+        double scale[ROW_CHUNK];
+        double twap_row[ROW_CHUNK];
+        double vwap_row[ROW_CHUNK];
+        std::vector<Window> windows(num_k);
+
+        auto fill_scale = [&](size_t first, size_t last) {
+            for (size_t s = first; s < last; ++s) {
+                scale[s - first] = base / p[s];
+            }
+        };
+        // Valid starts of slice count ki in the tile, empty if the window never fits
+        auto tile_end = [&](size_t begin, size_t end, size_t ki) {
+            size_t k = config.slice_counts[ki];
+            return begin + k > n ? begin : std::min(end, n - k + 1);
+        };
+
+        // Chunks start at begin + multiples of ROW_CHUNK, so this hits every RESEED_EVERY starts
+        auto seed_at = [&](size_t begin, size_t chunk) { return (chunk - begin) % RESEED_EVERY == 0; };
+
+        for (size_t tile = first_tile; tile < last_tile; ++tile) {
+            size_t begin = tile * block;
+            size_t end = std::min(num_starts, begin + block);
+
+            if (tiled) {
+                size_t seeded_at = begin;
+                for (size_t chunk = begin; chunk < end; chunk += ROW_CHUNK) {
+                    size_t chunk_end = std::min(end, chunk + ROW_CHUNK);
+                    bool reseed = seed_at(begin, chunk);
+                    if (reseed) {
+                        seeded_at = chunk;
+                    }
+                    fill_scale(chunk, chunk_end);
+                    for (size_t ki = 0; ki < num_k; ++ki) {
+                        size_t last = std::min(chunk_end, tile_end(begin, end, ki));
+                        if (last > chunk) {
+                            if (reseed) {
+                                windows[ki] = seed_window(p, v, chunk, config.slice_counts[ki]);
+                            }
+                            slide(p, v, scale, base, config.slice_counts[ki], seeded_at, chunk, last, windows[ki],
+                                  twap_row, vwap_row);
+                            row(tid, ki, chunk, last - chunk, twap_row, vwap_row);
+                        }
+                    }
+                }
+            } else {
+                for (size_t ki = 0; ki < num_k; ++ki) {
+                    size_t k_end = tile_end(begin, end, ki);
+                    size_t seeded_at = begin;
+                    for (size_t chunk = begin; chunk < k_end; chunk += ROW_CHUNK) {
+                        size_t last = std::min(k_end, chunk + ROW_CHUNK);
+                        if (seed_at(begin, chunk)) {
+                            windows[ki] = seed_window(p, v, chunk, config.slice_counts[ki]);
+                            seeded_at = chunk;
+                        }
+                        fill_scale(chunk, last);
+                        slide(p, v, scale, base, config.slice_counts[ki], seeded_at, chunk, last, windows[ki],
+                              twap_row, vwap_row);
+                        row(tid, ki, chunk, last - chunk, twap_row, vwap_row);
+                    }
+                }
+            }
+        }
+    });
+}
+
+} // namespace
+
+SweepGrid sweep_slices(const std::vector<double>& prices, const std::vector<double>& volumes,
+                       const SweepConfig& config) {
+    validate(prices, volumes, config);
+    SweepGrid grid;
+    grid.slice_counts = config.slice_counts;
+    grid.num_starts = num_starts_for(prices.size(), config.slice_counts);
+    size_t cells = grid.slice_counts.size() * grid.num_starts;
+    grid.twap_bps.assign(cells, std::numeric_limits<double>::quiet_NaN());
+    grid.vwap_bps.assign(cells, std::numeric_limits<double>::quiet_NaN());
+
+    double* twap = grid.twap_bps.data();
+    double* vwap = grid.vwap_bps.data();
+    size_t stride = grid.num_starts;
+    sweep_tiles(prices, volumes, config, grid.num_starts,
+                [=](size_t, size_t ki, size_t first, size_t count, const double* t, const double* w) {
+        std::copy(t, t + count, twap + ki * stride + first);
+        std::copy(w, w + count, vwap + ki * stride + first);
+    });
+    return grid;
+}
+
+std::vector<SliceStats> sweep_slice_stats(const std::vector<double>& prices, const std::vector<double>& volumes,
+                                          const SweepConfig& config) {
+    validate(prices, volumes, config);
+    size_t num_k = config.slice_counts.size();
+    size_t num_starts = num_starts_for(prices.size(), config.slice_counts);
+
+    // One accumulator row per worker, merged after the pass
+    struct Acc {
+        RunningMoments twap, vwap;
+    };
+    size_t max_workers = resolve_num_threads(config.num_threads);
+    std::vector<std::vector<Acc>> partials(max_workers, std::vector<Acc>(num_k));
+    sweep_tiles(prices, volumes, config, num_starts,
+                [&](size_t tid, size_t ki, size_t, size_t count, const double* t, const double* w) {
+        Acc& a = partials[tid][ki];
+        a.twap.add_batch(t, count);
+        a.vwap.add_batch(w, count);
+    });
+
+    std::vector<SliceStats> stats(num_k);
+    for (size_t ki = 0; ki < num_k; ++ki) {
+        Acc total;
+        for (const std::vector<Acc>& part : partials) {
+            total.twap.merge(part[ki].twap);
+            total.vwap.merge(part[ki].vwap);
+        }
+        SliceStats& out = stats[ki];
+        out.num_slices = config.slice_counts[ki];
+        out.count = total.twap.count;
+        if (out.count > 0) {
+            out.twap_mean_bps = total.twap.mean;
+            out.vwap_mean_bps = total.vwap.mean;
+            out.twap_std_bps = total.twap.sample_std();
+            out.vwap_std_bps = total.vwap.sample_std();
+        }
+    }
+    return stats;
+}
+
+} // namespace execution
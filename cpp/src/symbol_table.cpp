@@ -0,0 +1,152 @@
+#include "symbol_table.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+
+namespace execution {
+
+namespace {
+
+uint64_t mix64(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+constexpr uint32_t MAX_DISPLACEMENT = 1u << 20;
+
+} // namespace
+
+SymbolTable::SymbolTable(const std::vector<std::string>& tickers) {
+    for (const std::string& t : tickers) {
+        intern(t);
+    }
+    build();
+}
+
+// 8 bytes at a time; tickers are short so this is one or two rounds
+uint64_t SymbolTable::hash(std::string_view s, uint64_t seed) {
+    uint64_t h = seed ^ (s.size() * 0x9E3779B97F4A7C15ULL);
+    size_t i = 0;
+    for (; i + 8 <= s.size(); i += 8) {
+        uint64_t chunk;
+        std::memcpy(&chunk, s.data() + i, 8);
+        h = mix64(h ^ chunk);
+    }
+    if (i < s.size()) {
+        uint64_t chunk = 0;
+        std::memcpy(&chunk, s.data() + i, s.size() - i);
+        h = mix64(h ^ chunk);
+    }
+    return mix64(h);
+}
+
+// Buckets use the high half of h; the slot rehashes all of h with the bucket's displacement
+uint32_t SymbolTable::slot_of(uint64_t h, uint32_t d) const {
+    return static_cast<uint32_t>(mix64(h + d * 0x9E3779B97F4A7C15ULL) % slot_ids_.size());
+}
+
+uint32_t SymbolTable::intern(std::string_view symbol) {
+    auto [it, inserted] = loading_.try_emplace(std::string(symbol), static_cast<uint32_t>(names_.size()));
+    if (inserted) {
+        names_.emplace_back(symbol);
+        built_ = false;
+    }
+    return it->second;
+}
+
+void SymbolTable::build() {
+    size_t n = names_.size();
+    slot_ids_.assign(n, NOT_FOUND);
+    displacement_.assign(std::max<size_t>(1, (n + 3) / 4), 0);
+    if (n == 0) {
+        built_ = true;
+        return;
+    }
+    size_t num_buckets = displacement_.size();
+
+    for (uint64_t attempt = 0;; ++attempt) {
+        seed_ = mix64(attempt + 1);
+        std::vector<std::vector<uint32_t>> buckets(num_buckets);
+        std::vector<uint64_t> hashes(n);
+        for (uint32_t id = 0; id < n; ++id) {
+            hashes[id] = hash(names_[id], seed_);
+            buckets[(hashes[id] >> 32) % num_buckets].push_back(id);
+        }
+        // Largest buckets first, while the table is still empty
+        std::vector<uint32_t> order(num_buckets);
+        std::iota(order.begin(), order.end(), 0u);
+        std::stable_sort(order.begin(), order.end(),
+                         [&](uint32_t a, uint32_t b) { return buckets[a].size() > buckets[b].size(); });
+
+        std::fill(slot_ids_.begin(), slot_ids_.end(), NOT_FOUND);
+        std::vector<uint32_t> slots;
+        bool ok = true;
+        for (uint32_t b : order) {
+            const std::vector<uint32_t>& keys = buckets[b];
+            if (keys.empty()) {
+                break;
+            }
+            uint32_t d = 0;
+            for (; d < MAX_DISPLACEMENT; ++d) {
+                slots.clear();
+                bool fits = true;
+                for (uint32_t id : keys) {
+                    uint32_t s = slot_of(hashes[id], d);
+                    if (slot_ids_[s] != NOT_FOUND || std::find(slots.begin(), slots.end(), s) != slots.end()) {
+                        fits = false;
+                        break;
+                    }
+                    slots.push_back(s);
+                }
+                if (fits) {
+                    break;
+                }
+            }
+            if (d == MAX_DISPLACEMENT) {
+                ok = false;
+                break;
+            }
+            displacement_[b] = d;
+            for (size_t k = 0; k < keys.size(); ++k) {
+                slot_ids_[slots[k]] = keys[k];
+            }
+        }
+        if (ok) {
+            break;
+        }
+        if (attempt == 64) {
+            throw std::runtime_error("symbol table: perfect hash construction failed");
+        }
+        std::fill(displacement_.begin(), displacement_.end(), 0);
+    }
+    built_ = true;
+}
+
+uint32_t SymbolTable::find(std::string_view symbol) const {
+    if (!built_) {
+        auto it = loading_.find(std::string(symbol));
+        return it == loading_.end() ? NOT_FOUND : it->second;
+    }
+    if (names_.empty()) {
+        return NOT_FOUND;
+    }
+    uint64_t h = hash(symbol, seed_);
+    uint32_t id = slot_ids_[slot_of(h, displacement_[(h >> 32) % displacement_.size()])];
+    return names_[id] == symbol ? id : NOT_FOUND;
+}
+
+uint32_t SymbolTable::find_itch(const char (&stock)[8]) const {
+    size_t len = 8;
+    while (len > 0 && stock[len - 1] == ' ') {
+        --len;
+    }
+    return find(std::string_view(stock, len));
+}
+
+} // namespace execution
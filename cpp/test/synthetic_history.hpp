@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace execution {
+
+// Log-normal random walk with uniform volumes; days i % zero_period < zero_run
+// trade nothing. Callers inject their own NaN / negative edge cases.
+inline void random_walk(size_t n, uint64_t seed, size_t zero_period, size_t zero_run,
+                        std::vector<double>& prices, std::vector<double>& volumes) {
+    std::mt19937_64 rng(seed);
+    std::normal_distribution<double> ret(0.0, 0.01);
+    std::uniform_real_distribution<double> vol(0.0, 2e6);
+    prices.resize(n);
+    volumes.resize(n);
+    double p = 100.0;
+    for (size_t i = 0; i < n; ++i) {
+        p *= std::exp(ret(rng));
+        prices[i] = p;
+        volumes[i] = i % zero_period < zero_run ? 0.0 : vol(rng);
+    }
+}
+
+} // namespace execution
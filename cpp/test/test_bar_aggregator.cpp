@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include "bar_aggregator.hpp"
+
+#include <cmath>
+#include <limits>
+
+using namespace execution;
+
+namespace {
+
+constexpr int64_t SECOND = 1'000'000'000;
+
+TickData make_ticks(size_t n) {
+    TickData ticks;
+    for (size_t i = 0; i < n; ++i) {
+        ticks.push_back(static_cast<int64_t>(i) * SECOND / 4, 100.0 + std::sin(0.1 * i), 10.0 + i % 7);
+    }
+    return ticks;
+}
+
+} // namespace
+
+TEST(BarAggregatorTest, TimeBars) {
+    // Arrange
+    TickData ticks;
+    ticks.push_back(0, 10.0, 100.0);
+    ticks.push_back(20 * SECOND, 12.0, 50.0);
+    ticks.push_back(59 * SECOND, 11.0, 10.0);
+    ticks.push_back(61 * SECOND, 9.0, 5.0);
+    ticks.push_back(200 * SECOND, 8.0, 1.0);    // empty minutes are not emitted
+
+    // Act
+    std::vector<MarketData> bars = aggregate_bars(ticks, {{BarKind::Time, 60.0 * SECOND}});
+
+    // Assert
+    const MarketData& md = bars[0];
+    ASSERT_EQ(md.size(), 3u);
+    EXPECT_EQ(md.timestamps[0], 0);
+    EXPECT_DOUBLE_EQ(md.open[0], 10.0);
+    EXPECT_DOUBLE_EQ(md.high[0], 12.0);
+    EXPECT_DOUBLE_EQ(md.low[0], 10.0);
+    EXPECT_DOUBLE_EQ(md.close[0], 11.0);
+    EXPECT_DOUBLE_EQ(md.volume[0], 160.0);
+    EXPECT_EQ(md.timestamps[1], 60 * SECOND);
+    EXPECT_EQ(md.timestamps[2], 180 * SECOND);
+    EXPECT_DOUBLE_EQ(md.close[2], 8.0);
+}
+
+// Volume and dollar bars close on the tick reaching the threshold; bad ticks are skipped
+TEST(BarAggregatorTest, VolumeAndDollarBars) {
+    BarAggregator aggregator({{BarKind::Volume, 100.0}, {BarKind::Dollar, 2000.0}});
+
+    aggregator.on_tick(1, 10.0, 60.0);
+    aggregator.on_tick(2, 20.0, 50.0);      // volume 110 -> close; notional 1600
+    aggregator.on_tick(3, std::numeric_limits<double>::quiet_NaN(), 50.0);
+    aggregator.on_tick(4, 10.0, 0.0);
+    aggregator.on_tick(4, 10.0, std::numeric_limits<double>::infinity());
+    aggregator.on_tick(5, 10.0, 40.0);      // notional 2000 -> close
+    aggregator.flush();
+
+    const MarketData& volume_bars = aggregator.bars(0);
+    ASSERT_EQ(volume_bars.size(), 2u);
+    EXPECT_DOUBLE_EQ(volume_bars.volume[0], 110.0);
+    EXPECT_DOUBLE_EQ(volume_bars.high[0], 20.0);
+    EXPECT_EQ(volume_bars.timestamps[1], 5);
+
+    const MarketData& dollar_bars = aggregator.bars(1);
+    ASSERT_EQ(dollar_bars.size(), 1u);
+    EXPECT_DOUBLE_EQ(dollar_bars.volume[0], 150.0);
+    EXPECT_DOUBLE_EQ(dollar_bars.close[0], 10.0);
+    EXPECT_EQ(aggregator.num_skipped(), 3u);
+}
+
+// Chunked streaming gives the same bars as one pass, and reserved columns never move
+TEST(BarAggregatorTest, StreamingMatchesOneShotWithoutReallocation) {
+    TickData ticks = make_ticks(100'000);
+    std::vector<BarSpec> specs = {{BarKind::Time, 5.0 * SECOND}, {BarKind::Volume, 1000.0}, {BarKind::Dollar, 5e5}};
+    std::vector<MarketData> expected = aggregate_bars(ticks, specs);
+
+    BarAggregator aggregator(specs);
+    aggregator.reserve(ticks.count());
+    const double* close_data[3];
+    for (size_t s = 0; s < 3; ++s) {
+        close_data[s] = aggregator.bars(s).close.data();
+    }
+    for (size_t begin = 0; begin < ticks.count(); begin += 4096) {
+        size_t n = std::min<size_t>(4096, ticks.count() - begin);
+        aggregator.on_ticks(ticks.timestamps.data() + begin, ticks.price.data() + begin, ticks.size.data() + begin, n);
+    }
+    aggregator.flush();
+
+    for (size_t s = 0; s < 3; ++s) {
+        const MarketData& md = aggregator.bars(s);
+        EXPECT_EQ(md.close.data(), close_data[s]);
+        ASSERT_EQ(md.size(), expected[s].size());
+        EXPECT_EQ(md.timestamps, expected[s].timestamps);
+        EXPECT_EQ(md.close, expected[s].close);
+        EXPECT_EQ(md.volume, expected[s].volume);
+    }
+    EXPECT_EQ(expected[0].size(), 5000u);
+}
+
+TEST(BarAggregatorTest, MismatchedColumnsThrow) {
+    TickData ticks = make_ticks(10);
+    ticks.timestamps.clear();
+
+    EXPECT_THROW(aggregate_bars(ticks, {{BarKind::Time, 1.0 * SECOND}}), std::invalid_argument);
+}
+
+TEST(BarAggregatorTest, BadThresholdsThrow) {
+    const double inf = std::numeric_limits<double>::infinity();
+
+    EXPECT_THROW(BarAggregator({{BarKind::Volume, inf}}), std::invalid_argument);
+    EXPECT_THROW(BarAggregator({{BarKind::Dollar, std::nan("")}}), std::invalid_argument);
+    EXPECT_THROW(BarAggregator({{BarKind::Time, inf}}), std::invalid_argument);
+    EXPECT_THROW(BarAggregator({{BarKind::Time, 1e19}}), std::invalid_argument);      // past int64 ns
+    EXPECT_THROW(BarAggregator({{BarKind::Time, 0.5}}), std::invalid_argument);       // under 1 ns
+    EXPECT_NO_THROW(BarAggregator({{BarKind::Time, 9e18}}));
+}
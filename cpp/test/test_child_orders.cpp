@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include "child_orders.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+using namespace execution;
+
+// Count every heap allocation made by this test binary (malloc / free pair up
+// inside the replacements, which GCC cannot see through)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+namespace {
+std::atomic<size_t> g_allocations{0};
+}
+
+void* operator new(std::size_t size) {
+    ++g_allocations;
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+struct Tracked {
+    static inline int alive = 0;
+    int value;
+    ListHook<Tracked> a;
+    ListHook<Tracked> b;
+    explicit Tracked(int v) : value(v) { ++alive; }
+    ~Tracked() { --alive; }
+};
+
+} // namespace
+
+TEST(ObjectPoolTest, FixedCapacityAndReuse) {
+    {
+        ObjectPool<Tracked> pool(2);
+        Tracked* x = pool.allocate(1);
+        Tracked* y = pool.allocate(2);
+
+        EXPECT_EQ(pool.allocate(3), nullptr);   // exhausted
+        EXPECT_TRUE(pool.full());
+        pool.release(x);
+        Tracked* z = pool.allocate(4);
+        EXPECT_EQ(z, x);                        // slot reused, address stable
+        EXPECT_EQ(z->value, 4);
+        EXPECT_EQ(pool.index_of(y), 1u);
+        EXPECT_EQ(Tracked::alive, 2);
+    }
+    EXPECT_EQ(Tracked::alive, 0);               // live objects destroyed with the pool
+    EXPECT_THROW(ObjectPool<Tracked>(0), std::invalid_argument);
+}
+
+TEST(IntrusiveListTest, MembershipInTwoLists) {
+    ObjectPool<Tracked> pool(4);
+    IntrusiveList<Tracked, &Tracked::a> list_a;
+    IntrusiveList<Tracked, &Tracked::b> list_b;
+    std::vector<Tracked*> items;
+    for (int i = 0; i < 4; ++i) {
+        items.push_back(pool.allocate(i));
+        list_a.push_back(*items.back());
+        list_b.push_front(*items.back());
+    }
+
+    list_a.remove(*items[1]);
+    list_b.remove(*items[2]);
+
+    std::vector<int> order_a;
+    for (Tracked& t : list_a) order_a.push_back(t.value);
+    std::vector<int> order_b;
+    for (Tracked& t : list_b) order_b.push_back(t.value);
+    EXPECT_EQ(order_a, (std::vector<int>{0, 2, 3}));
+    EXPECT_EQ(order_b, (std::vector<int>{3, 1, 0}));
+    EXPECT_FALSE(items[1]->a.linked);
+    EXPECT_TRUE(items[1]->b.linked);
+    EXPECT_EQ(list_a.pop_front()->value, 0);
+    EXPECT_EQ(list_a.size(), 2u);
+}
+
+TEST(ChildOrderStoreTest, LevelAndParentMembership) {
+    ChildOrderStore store(16, 16);
+    ChildOrder* a = store.create(7, Side::Buy, 100, 300);
+    ChildOrder* b = store.create(7, Side::Buy, 100, 200);
+    ChildOrder* c = store.create(8, Side::Sell, 101, 100);
+
+    store.amend(*a, 100, 250);                  // smaller: keeps priority
+    store.amend(*b, 100, 400);                  // larger: back of the queue (already last)
+    store.amend(*a, 99, 250);                   // new price: leaves level 100
+    store.fill(*b, 150, 100, 1);
+    store.fill(*c, 500, 101, 2);                // capped, completes c
+
+    EXPECT_EQ(store.level(Side::Buy, 100)->front(), b);
+    EXPECT_EQ(store.level(Side::Buy, 99)->front(), a);
+    EXPECT_EQ(store.level(Side::Sell, 101), nullptr);
+    EXPECT_EQ(c->filled, 100u);
+    EXPECT_FALSE(c->working);
+    EXPECT_EQ(store.children(7)->size(), 2u);
+    EXPECT_EQ(b->fills.front()->quantity, 150u);
+    EXPECT_FALSE(store.amend(*b, 100, 150));    // not above filled
+
+    uint64_t c_id = c->id;
+    store.release(*c);
+    EXPECT_EQ(store.children(8), nullptr);
+    EXPECT_EQ(store.find(c_id), nullptr);
+    EXPECT_EQ(store.find(a->id), a);
+    EXPECT_EQ(store.num_fills(), 1u);
+}
+
+// Steady-state create / amend / fill / cancel / release never reaches operator new
+TEST(ChildOrderStoreTest, LifecycleDoesNotAllocate) {
+    ChildOrderStore store(1024, 4096, 64, 64);
+    std::vector<ChildOrder*> live;
+    live.reserve(1024);
+
+    size_t before = g_allocations.load();
+    for (uint64_t i = 0; i < 100'000; ++i) {
+        uint64_t parent = i % 32;
+        ChildOrder* order = store.create(parent, i % 2 ? Side::Buy : Side::Sell, 100 + static_cast<int64_t>(i % 16), 500);
+        ASSERT_NE(order, nullptr);
+        store.amend(*order, order->price, 400);
+        store.fill(*order, 100, order->price, i);
+        if (i % 3 == 0) {
+            store.fill(*order, 300, order->price, i);
+        } else {
+            store.cancel(*order);
+        }
+        live.push_back(order);
+        if (live.size() == 512) {
+            for (ChildOrder* o : live) {
+                store.release(*o);
+            }
+            live.clear();
+        }
+    }
+    size_t after = g_allocations.load();
+
+    EXPECT_EQ(after - before, 0u);
+    EXPECT_EQ(store.num_orders(), live.size());
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include "data_loader.hpp"
+#include "kernels.hpp"
+
+#include <cmath>
+
+using namespace execution;
+
+namespace {
+
+// Early rows without volume, a missing close, a NaN and a negative volume, CRLF endings
+const char* CSV =
+    "Date,Close,High,Low,Open,Volume\r\n"
+    "12/30/1927,17.66,17.66,17.66,17.66,0\r\n"
+    "1/3/1928,,17.76,17.76,17.76,0\r\n"
+    "1/4/1928,17.72,17.72,17.72,17.72,NaN\r\n"
+    "1950-01-03,16.66,16.66,16.66,16.66,1260000\r\n"
+    "1950-01-04,16.85,16.85,16.85,16.85,-5\r\n"
+    "1950-01-05,16.93,16.93,16.93,16.93,2550000\r\n";
+
+} // namespace
+
+TEST(DataLoaderTest, DefaultPoliciesCleanInOnePass) {
+    CleanData data = parse_market_data(CSV);
+    const MarketData& bars = data.bars;
+
+    ASSERT_EQ(bars.size(), 6u);
+    EXPECT_EQ(bars.timestamps[0], 19271230);
+    EXPECT_EQ(bars.timestamps[3], 19500103);
+    EXPECT_DOUBLE_EQ(bars.close[1], 17.66);         // forward-filled
+    EXPECT_DOUBLE_EQ(bars.volume[2], 0.0);          // NaN -> 0
+    EXPECT_DOUBLE_EQ(bars.volume[4], 0.0);          // negative -> 0
+
+    EXPECT_EQ(data.report.rows, 6u);
+    EXPECT_EQ(data.report.nan_prices, 1u);
+    EXPECT_EQ(data.report.nan_volumes, 2u);
+    EXPECT_EQ(data.report.zero_volume_rows, 4u);
+    EXPECT_EQ(data.report.first_traded, 3u);
+
+    EXPECT_EQ(data.has_volume.count(), 2u);
+    EXPECT_FALSE(data.has_volume.any(0, 3));
+    EXPECT_TRUE(data.has_volume.test(5));
+
+    // Clean columns: the unclamped kernel agrees with the checked one
+    EXPECT_DOUBLE_EQ(vwap_avg_price_clean(&bars.close[2], &bars.volume[2], 4),
+                     vwap_avg_price(&bars.close[2], &bars.volume[2], 4));
+}
+
+TEST(DataLoaderTest, PoliciesAndValidation) {
+    CleanConfig drop;
+    drop.price_nan = NanPolicy::DropRow;
+    drop.volume_nan = NanPolicy::DropRow;
+    CleanData dropped = parse_market_data(CSV, drop);
+    EXPECT_EQ(dropped.bars.size(), 3u);
+    EXPECT_EQ(dropped.report.dropped_rows, 3u);
+    EXPECT_EQ(dropped.has_volume.size(), 3u);
+
+    CleanConfig keep;
+    keep.volume_nan = NanPolicy::Keep;
+    EXPECT_TRUE(std::isnan(parse_market_data(CSV, keep).bars.volume[2]));
+
+    MarketData out_of_order;
+    out_of_order.push_back(20240102, 1, 1, 1, 1, 10);
+    out_of_order.push_back(20240102, 1, 1, 1, 1, 10);
+    EXPECT_THROW(clean_market_data(out_of_order), std::invalid_argument);
+    CleanConfig lenient;
+    lenient.require_increasing_dates = false;
+    EXPECT_EQ(clean_market_data(out_of_order, lenient).bars.size(), 2u);
+
+    MarketData infinite;
+    infinite.push_back(20240102, 1, 1, 1, 1, 10);
+    infinite.push_back(20240103, 1, 1, 1, 1, INFINITY);
+    CleanData zeroed = clean_market_data(infinite);
+    EXPECT_DOUBLE_EQ(zeroed.bars.volume[1], 0.0);
+    EXPECT_EQ(zeroed.report.nan_volumes, 1u);
+    EXPECT_FALSE(zeroed.has_volume.test(1));
+    CleanConfig ffill;
+    ffill.volume_nan = NanPolicy::ForwardFill;
+    EXPECT_DOUBLE_EQ(clean_market_data(infinite, ffill).bars.volume[1], 10.0);
+
+    EXPECT_THROW(parse_market_data("Date,Close\n1/1/2020,3\n"), std::runtime_error);
+    EXPECT_THROW(parse_market_data("Date,Open,High,Low,Close,Volume\n2020/13/01,1,1,1,1,1\n"), std::runtime_error);
+    EXPECT_THROW(load_market_data("/nonexistent/bars.csv"), std::runtime_error);
+}
+
+TEST(DataLoaderTest, BitMaskRangeCounts) {
+    BitMask mask;
+    for (size_t i = 0; i < 200; ++i) {
+        mask.push_back(i % 3 == 0);
+    }
+    for (size_t begin : {0, 1, 63, 64, 130}) {
+        for (size_t end : {begin, begin + 1, size_t{64}, size_t{128}, size_t{200}}) {
+            if (end < begin) {
+                continue;
+            }
+            size_t expected = 0;
+            for (size_t i = begin; i < end; ++i) {
+                expected += i % 3 == 0;
+            }
+            EXPECT_EQ(mask.count(begin, end), expected) << begin << ".." << end;
+        }
+    }
+    EXPECT_TRUE(mask.all(3, 4));
+    EXPECT_THROW(mask.count(190, 201), std::out_of_range);
+    EXPECT_THROW(mask.any(0, 256), std::out_of_range);
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include "dp_solver.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+using namespace execution;
+
+// Linear impact (quadratic cost), no risk: the optimum is an equal split (TWAP)
+TEST(DPSolverTest, LinearImpactGivesTwap) {
+    // Arrange
+    DPConfig config;
+    config.num_steps = 20;
+    config.num_lots = 200;
+    DPCostModel model;
+    model.beta = 1.0;
+
+    // Act
+    DPSchedule schedule = solve_optimal_schedule(config, model);
+
+    // Assert
+    ASSERT_TRUE(schedule.used_convex_path);
+    for (double shares : schedule.trades) {
+        EXPECT_DOUBLE_EQ(shares, 10 * config.lot_size);
+    }
+}
+
+// Slope-merge path agrees with brute force
+TEST(DPSolverTest, ConvexMatchesExhaustive) {
+    DPConfig config;
+    config.num_steps = 30;
+    config.num_lots = 300;
+    for (size_t t = 0; t < config.num_steps; ++t) {
+        config.volume_profile.push_back(1e5 * (1.0 + 0.5 * ((t % 7) / 7.0)));
+    }
+    DPCostModel model;
+    model.risk_aversion = 1e-6;
+    model.sigma = 0.5;
+
+    DPSchedule fast = solve_optimal_schedule(config, model);
+    DPSchedule brute = solve_optimal_schedule_exhaustive(config, model);
+
+    EXPECT_NEAR(fast.expected_cost, brute.expected_cost, 1e-6 * brute.expected_cost);
+    double total = std::accumulate(fast.trades.begin(), fast.trades.end(), 0.0);
+    EXPECT_DOUBLE_EQ(total, config.num_lots * config.lot_size);
+    // risk aversion front-loads the schedule
+    EXPECT_GT(fast.trades.front(), fast.trades.back());
+}
+
+// Fixed cost per trade: fewer, larger trades
+TEST(DPSolverTest, FixedCostUsesExhaustivePath) {
+    DPConfig config;
+    config.num_steps = 20;
+    config.num_lots = 100;
+    config.num_threads = 4;
+    DPCostModel model;
+    model.beta = 1.0;
+    model.eta = 1e-6;
+    model.fixed_cost = 50.0;
+
+    DPSchedule schedule = solve_optimal_schedule(config, model);
+
+    size_t active = std::count_if(schedule.trades.begin(), schedule.trades.end(), [](double s) { return s > 0.0; });
+    EXPECT_FALSE(schedule.used_convex_path);
+    EXPECT_LT(active, config.num_steps);
+    EXPECT_DOUBLE_EQ(std::accumulate(schedule.trades.begin(), schedule.trades.end(), 0.0), 100 * config.lot_size);
+}
+
+// Negative risk aversion (risk seeking) is concave: brute force, which back-loads
+TEST(DPSolverTest, NegativeRiskAversionUsesExhaustivePath) {
+    DPConfig config;
+    config.num_steps = 10;
+    config.num_lots = 100;
+    DPCostModel model;
+    model.beta = 1.0;
+    model.eta = 1e-6;
+    model.risk_aversion = -1e-6;
+    model.sigma = 1.0;
+
+    DPSchedule schedule = solve_optimal_schedule(config, model);
+    DPSchedule brute = solve_optimal_schedule_exhaustive(config, model);
+
+    EXPECT_FALSE(schedule.used_convex_path);
+    EXPECT_DOUBLE_EQ(schedule.expected_cost, brute.expected_cost);
+    EXPECT_LT(schedule.trades.front(), schedule.trades.back());
+}
+
+TEST(DPSolverTest, FullSizeGrid) {
+    DPConfig config;    // 200 steps x 10k lots
+    DPCostModel model;
+    model.risk_aversion = 1e-9;
+    model.sigma = 1.0;
+
+    DPSchedule schedule = solve_optimal_schedule(config, model);
+
+    EXPECT_EQ(schedule.trades.size(), 200u);
+    EXPECT_DOUBLE_EQ(std::accumulate(schedule.trades.begin(), schedule.trades.end(), 0.0), 10'000 * config.lot_size);
+}
+
+// NaN fails every comparison in convex(): rejected instead of silently taking the exhaustive path
+TEST(DPSolverTest, RejectsNonFiniteParameters) {
+    DPConfig config;
+    config.num_steps = 5;
+    config.num_lots = 10;
+    double bad[] = {std::nan(""), HUGE_VAL};
+
+    for (double x : bad) {
+        for (double DPCostModel::*field : {&DPCostModel::eta, &DPCostModel::beta, &DPCostModel::fixed_cost,
+                                           &DPCostModel::risk_aversion, &DPCostModel::sigma}) {
+            DPCostModel model;
+            model.*field = x;
+            EXPECT_THROW(solve_optimal_schedule(config, model), std::invalid_argument);
+            EXPECT_THROW(solve_optimal_schedule_exhaustive(config, model), std::invalid_argument);
+        }
+        DPConfig bad_lot = config;
+        bad_lot.lot_size = x;
+        EXPECT_THROW(solve_optimal_schedule(bad_lot, DPCostModel{}), std::invalid_argument);
+    }
+}
@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include "execution_cost.hpp"
+
+#include <cmath>
+
+using namespace execution;
+
+namespace {
+
+void make_history(std::vector<double>& prices, std::vector<double>& volumes, size_t n) {
+    prices.resize(n);
+    volumes.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        prices[i] = 100.0 + 5.0 * std::sin(0.11 * i) + 0.01 * i;
+        volumes[i] = 2e5 * (1.5 + std::cos(0.07 * i));
+    }
+}
+
+} // namespace
+
+TEST(DualTest, ChainRule) {
+    // f(x) = x sinh(x) + sqrt(x), f'(x) = sinh(x) + x cosh(x) + 1 / (2 sqrt(x))
+    auto x = Dual<1>::variable(1.3, 0);
+
+    auto f = x * sinh(x) + sqrt(x);
+
+    double expected = std::sinh(1.3) + 1.3 * std::cosh(1.3) + 0.5 / std::sqrt(1.3);
+    EXPECT_NEAR(f.d[0], expected, 1e-12);
+}
+
+// Dual gradient matches central finite differences
+TEST(ExecutionCostTest, GradientMatchesFiniteDifference) {
+    // Arrange
+    std::vector<double> prices, volumes;
+    make_history(prices, volumes, 500);
+    Order order(50'000.0, "buy", 10);
+    CostModel model;
+    double eta = 20.0;
+    double lambda = 5e-4;
+
+    // Act
+    CostGradient g = history_cost_gradient(prices, volumes, order, eta, lambda, model, 4);
+    auto objective = [&](double e, double l) {
+        return history_cost_gradient(prices, volumes, order, e, l, model, 1).objective_bps;
+    };
+    double h_eta = 1e-4;
+    double h_lambda = 1e-8;
+    double fd_eta = (objective(eta + h_eta, lambda) - objective(eta - h_eta, lambda)) / (2 * h_eta);
+    double fd_lambda = (objective(eta, lambda + h_lambda) - objective(eta, lambda - h_lambda)) / (2 * h_lambda);
+
+    // Assert
+    EXPECT_EQ(g.count, 491u);
+    EXPECT_NEAR(g.d_eta, fd_eta, 1e-5 * std::max(1.0, std::abs(fd_eta)));
+    EXPECT_NEAR(g.d_risk_aversion, fd_lambda, 1e-4 * std::max(1.0, std::abs(fd_lambda)));
+}
+
+TEST(ExecutionCostTest, TuningLowersObjective) {
+    std::vector<double> prices, volumes;
+    make_history(prices, volumes, 500);
+    Order order(50'000.0, "buy", 10);
+    CostModel model;
+
+    CostGradient start = history_cost_gradient(prices, volumes, order, 20.0, 1e-2, model);
+    TuningResult tuned = tune_risk_aversion(prices, volumes, order, 20.0, 1e-2, model);
+
+    EXPECT_GT(tuned.risk_aversion, 0.0);
+    EXPECT_LE(tuned.objective_bps, start.objective_bps);
+}
+
+// NaN fails both `<= 0` and `< 0`, so it needs its own rejection
+TEST(ExecutionCostTest, NonFiniteParametersThrow) {
+    std::vector<double> prices, volumes;
+    make_history(prices, volumes, 100);
+    Order order(50'000.0, "buy", 10);
+    CostModel model;
+    double nan = std::nan("");
+
+    EXPECT_THROW(history_cost_gradient(prices, volumes, order, nan, 1e-2, model), std::invalid_argument);
+    EXPECT_THROW(history_cost_gradient(prices, volumes, order, 20.0, nan, model), std::invalid_argument);
+    EXPECT_THROW(history_cost_gradient(prices, volumes, order, INFINITY, 1e-2, model), std::invalid_argument);
+    EXPECT_THROW(tune_risk_aversion(prices, volumes, order, nan, 1e-2, model), std::invalid_argument);
+    EXPECT_THROW(tune_risk_aversion(prices, volumes, order, 20.0, nan, model), std::invalid_argument);
+}
+
+// Schedule table + window loop reproduce the original per-window formula
+// (holdings inline, drift divided per slice), up to rounding
+TEST(ExecutionCostTest, ScheduleMatchesInlineReference) {
+    std::vector<double> prices, volumes;
+    make_history(prices, volumes, 80);
+    CostModel model;
+    using D = Dual<2>;
+    const size_t n = 10;
+    const double size = 5e4;
+    const double sign = -1.0;
+
+    for (double lambda : {5e-4, 1e-16}) {       // Almgren-Chriss and the TWAP limit
+        CostParams<D> params{D::variable(20.0, 0), D::variable(lambda, 1)};
+        CostSchedule<D> schedule = cost_schedule<D>(n, params, model);
+        for (size_t s : {0, 7, 70}) {
+            const double* p = prices.data() + s;
+            const double* v = volumes.data() + s;
+
+            double sigma2 = model.sigma_bps * model.sigma_bps;
+            D kappa = sqrt(params.risk_aversion * sigma2 / params.eta);
+            bool linear = kappa.v < 1e-6;
+            D denom = linear ? D(1.0) : sinh(kappa * static_cast<double>(n));
+            D cost(0.0), risk(0.0), prev(1.0);
+            for (size_t j = 1; j <= n; ++j) {
+                double remaining = static_cast<double>(n - j);
+                D holding = linear ? D(remaining / n) : sinh(kappa * remaining) / denom;
+                D traded = prev - holding;
+                double drift_bps = sign * (p[j - 1] - p[0]) / p[0] * 10000.0;
+                cost += traded * (drift_bps + params.eta * (traded * (size / v[j - 1])));
+                risk += holding * holding;
+                prev = holding;
+            }
+            D objective = cost + risk * (model.variance_penalty * sigma2);
+
+            auto c = execution_cost(p, v, size, sign, params, schedule);
+            EXPECT_NEAR(c.objective_bps.v, objective.v, 1e-9 * (1.0 + std::abs(objective.v)));
+            // The reference's TWAP limit drops d/d lambda; TwapLimitKeepsRiskAversionGradient covers it
+            for (int k = 0; k < (linear ? 1 : 2); ++k) {
+                EXPECT_NEAR(c.objective_bps.d[k], objective.d[k], 1e-9 * (1.0 + std::abs(objective.d[k])));
+            }
+        }
+    }
+}
+
+// kappa n far past where sinh overflows: holdings and gradient stay finite
+TEST(ExecutionCostTest, LargeRiskAversionStaysFinite) {
+    std::vector<double> prices, volumes;
+    make_history(prices, volumes, 300);
+    Order order(50'000.0, "buy", 50);
+    CostModel model;
+
+    // kappa = sqrt(1e3 * 1e4 / 20) ~ 707 per slice, kappa n ~ 35000
+    CostGradient g = history_cost_gradient(prices, volumes, order, 20.0, 1e3, model, 2);
+    CostSchedule<double> schedule = cost_schedule<double>(50, CostParams<double>{20.0, 1e3}, model);
+
+    EXPECT_TRUE(std::isfinite(g.objective_bps));
+    EXPECT_TRUE(std::isfinite(g.d_eta));
+    EXPECT_TRUE(std::isfinite(g.d_risk_aversion));
+    EXPECT_NEAR(schedule.traded[0], 1.0, 1e-12);        // everything goes in the first slice
+    EXPECT_NEAR(schedule.traded[1], 0.0, 1e-12);
+}
+
+// Near lambda = 0 the schedule is TWAP but d/d lambda is not zero, so tuning
+// from a tiny lambda still moves
+TEST(ExecutionCostTest, TwapLimitKeepsRiskAversionGradient) {
+    std::vector<double> prices, volumes;
+    make_history(prices, volumes, 500);
+    Order order(50'000.0, "buy", 10);
+    CostModel model;
+    double eta = 20.0;
+
+    CostSchedule<double> twap = cost_schedule<double>(10, CostParams<double>{eta, 1e-14}, model);
+    for (double traded : twap.traded) {
+        EXPECT_NEAR(traded, 0.1, 1e-9);
+    }
+
+    // Series branch at 1e-14 vs a forward difference, and continuity with the
+    // exact branch across the switch (kappa n = 1e-3 at lambda = 2e-11)
+    auto objective = [&](double l) {
+        return history_cost_gradient(prices, volumes, order, eta, l, model, 1).objective_bps;
+    };
+    CostGradient g = history_cost_gradient(prices, volumes, order, eta, 1e-14, model, 1);
+    double fd = (objective(1e-7) - objective(1e-14)) / 1e-7;
+    EXPECT_NE(g.d_risk_aversion, 0.0);
+    EXPECT_NEAR(g.d_risk_aversion, fd, 1e-3 * std::abs(fd));
+
+    CostGradient below = history_cost_gradient(prices, volumes, order, eta, 1.999e-11, model, 1);
+    CostGradient above = history_cost_gradient(prices, volumes, order, eta, 2.001e-11, model, 1);
+    EXPECT_NEAR(below.objective_bps, above.objective_bps, 1e-9 * std::abs(above.objective_bps));
+    EXPECT_NEAR(below.d_risk_aversion, above.d_risk_aversion, 1e-6 * std::abs(above.d_risk_aversion));
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include "execution_env.hpp"
+
+#include <cmath>
+
+using namespace execution;
+
+namespace {
+
+EnvConfig small_config() {
+    EnvConfig config;
+    config.num_envs = 64;
+    config.horizon = 5;
+    config.order_size = 1000.0;
+    config.eta = 10.0;
+    return config;
+}
+
+} // namespace
+
+TEST(ExecutionEnvTest, ResetObservations) {
+    std::vector<double> prices(100, 50.0);
+    std::vector<double> volumes(100, 1e6);
+
+    ExecutionEnv env(prices, volumes, small_config());
+
+    const float* obs = env.observations();
+    EXPECT_FLOAT_EQ(obs[0], 1.0f);      // nothing traded
+    EXPECT_FLOAT_EQ(obs[1], 1.0f);      // full horizon left
+    EXPECT_FLOAT_EQ(obs[2], 0.0f);      // at arrival price
+    EXPECT_EQ(env.num_valid_starts(), 96u);
+}
+
+// Holding everything to the horizon forces one block trade: only impact is paid on flat prices
+TEST(ExecutionEnvTest, ForcedLiquidationAtHorizon) {
+    // Arrange
+    std::vector<double> prices(100, 50.0);
+    std::vector<double> volumes(100, 1e4);
+    EnvConfig config = small_config();
+    ExecutionEnv env(prices, volumes, config);
+    std::vector<float> hold(config.num_envs, 0.0f);
+
+    // Act
+    double total_reward = 0.0;
+    for (size_t t = 0; t < config.horizon; ++t) {
+        env.step(hold.data());
+        total_reward += env.rewards()[0];
+        EXPECT_EQ(env.dones()[0], t + 1 == config.horizon ? 1 : 0);
+    }
+
+    // Assert: eta * 1000 / 1e4 = 1 bps
+    EXPECT_NEAR(total_reward, -1.0, 1e-6);
+    EXPECT_NEAR(env.last_episode_costs()[0], 1.0, 1e-6);
+    EXPECT_FLOAT_EQ(env.observations()[0], 1.0f);   // auto-reset
+}
+
+// Zero-volume days (pre-1950 rows) never appear inside an episode
+TEST(ExecutionEnvTest, SkipsZeroVolumeWindows) {
+    std::vector<double> prices(50, 10.0);
+    std::vector<double> volumes(50, 1e5);
+    for (size_t i = 0; i < 30; ++i) {
+        volumes[i] = 0.0;
+    }
+    EnvConfig config = small_config();
+    config.num_threads = 4;
+
+    ExecutionEnv env(prices, volumes, config);
+    std::vector<float> half(config.num_envs, 0.5f);
+    env.step(half.data());
+
+    EXPECT_EQ(env.num_valid_starts(), 16u);
+    EXPECT_FLOAT_EQ(env.observations()[0], 0.5f);
+}
+
+// Bad prices would put inf / NaN into drift, so windows over them are skipped
+TEST(ExecutionEnvTest, SkipsInvalidPriceWindows) {
+    std::vector<double> prices(50, 10.0);
+    std::vector<double> volumes(50, 1e5);
+    prices[10] = 0.0;
+    prices[20] = -1.0;
+    prices[30] = std::nan("");
+    prices[40] = INFINITY;
+    EnvConfig config = small_config();
+
+    ExecutionEnv env(prices, volumes, config);
+    std::vector<float> half(config.num_envs, 0.5f);
+    env.step(half.data());
+
+    // runs 0-9, 11-19, 21-29, 31-39, 41-49 hold 6 + 5 + 5 + 5 + 5 windows
+    EXPECT_EQ(env.num_valid_starts(), 26u);
+    for (size_t i = 0; i < config.num_envs; ++i) {
+        EXPECT_TRUE(std::isfinite(env.rewards()[i]));
+        EXPECT_TRUE(std::isfinite(env.observations()[i * ExecutionEnv::OBS_DIM + 2]));
+    }
+}
+
+// A NaN / inf action holds: the forced liquidation still prices the whole order
+TEST(ExecutionEnvTest, NonFiniteActionsHold) {
+    std::vector<double> prices(100, 50.0);
+    std::vector<double> volumes(100, 1e4);
+    EnvConfig config = small_config();
+    ExecutionEnv env(prices, volumes, config);
+    std::vector<float> actions(config.num_envs, std::nanf(""));
+    actions[1] = INFINITY;
+
+    for (size_t t = 0; t < config.horizon; ++t) {
+        env.step(actions.data());
+        EXPECT_TRUE(std::isfinite(env.rewards()[0]));
+        EXPECT_TRUE(std::isfinite(env.observations()[0]));
+    }
+
+    EXPECT_NEAR(env.last_episode_costs()[0], 1.0, 1e-6);
+    EXPECT_NEAR(env.last_episode_costs()[1], 1.0, 1e-6);
+}
+
+// The env's worker pool is reused across steps and matches the serial env
+TEST(ExecutionEnvTest, PooledStepsMatchSerial) {
+    std::vector<double> prices(300), volumes(300, 1e5);
+    for (size_t i = 0; i < prices.size(); ++i) {
+        prices[i] = 100.0 + std::sin(0.3 * i);
+    }
+    EnvConfig config = small_config();
+    config.num_envs = 37;
+    ExecutionEnv serial(prices, volumes, config);
+    config.num_threads = 3;
+    ExecutionEnv pooled(prices, volumes, config);
+
+    std::vector<float> actions(config.num_envs);
+    for (int step = 0; step < 200; ++step) {
+        for (size_t i = 0; i < actions.size(); ++i) {
+            actions[i] = static_cast<float>((i + step) % 5) / 4.0f;
+        }
+        serial.step(actions.data());
+        pooled.step(actions.data());
+        for (size_t i = 0; i < config.num_envs; ++i) {
+            ASSERT_EQ(serial.rewards()[i], pooled.rewards()[i]) << "step " << step << " env " << i;
+        }
+    }
+}
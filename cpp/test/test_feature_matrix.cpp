@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include "feature_matrix.hpp"
+
+#include <cmath>
+
+using namespace execution;
+
+namespace {
+
+MarketData make_symbol(size_t n, double phase) {
+    MarketData md;
+    for (size_t i = 0; i < n; ++i) {
+        double c = 100.0 + 10.0 * std::sin(0.013 * i + phase) + 0.001 * i;
+        md.push_back(static_cast<int64_t>(i), c * 0.999, c * 1.01, c * 0.985, c, 1e6 * (2.0 + std::cos(0.07 * i)));
+    }
+    return md;
+}
+
+FeatureMatrixBuilder all_features() {
+    FeatureMatrixBuilder builder;
+    builder.add(FeatureKind::Return, 5)
+           .add(FeatureKind::LogReturn, 1)
+           .add(FeatureKind::RollingVol, 20)
+           .add(FeatureKind::VolumeRatio, 10)
+           .add(FeatureKind::Range)
+           .add(FeatureKind::Gap)
+           .add(FeatureKind::ParkinsonVol, 20);
+    return builder;
+}
+
+} // namespace
+
+// Sliding-window values (across block boundaries) match a direct computation
+TEST(FeatureMatrixTest, MatchesDirectComputation) {
+    // Arrange
+    MarketData md = make_symbol(5000, 0.0);
+    FeatureMatrixBuilder builder = all_features();
+
+    // Act
+    FeatureMatrix m = builder.build({md}, MatrixLayout::RowMajor, 4);
+
+    // Assert
+    ASSERT_EQ(m.rows, 5000u);
+    ASSERT_EQ(m.cols, 7u);
+    for (size_t i : {0ul, 19ul, 20ul, 2047ul, 2048ul, 2049ul, 4999ul}) {
+        if (i >= 20) {
+            double sum = 0.0, sq = 0.0;
+            for (size_t j = i - 19; j <= i; ++j) {
+                double r = std::log(md.close[j] / md.close[j - 1]);
+                sum += r;
+                sq += r * r;
+            }
+            double mean = sum / 20;
+            EXPECT_NEAR(m.at(i, 2), std::sqrt((sq - 20 * mean * mean) / 19), 1e-10) << "row " << i;
+        } else {
+            EXPECT_TRUE(std::isnan(m.at(i, 2)));
+        }
+        if (i >= 5) {
+            EXPECT_NEAR(m.at(i, 0), md.close[i] / md.close[i - 5] - 1.0, 1e-12);
+        }
+        EXPECT_NEAR(m.at(i, 4), (md.high[i] - md.low[i]) / md.close[i], 1e-12);
+    }
+}
+
+// Both layouts hold the same values, symbols stacked symbol-major
+TEST(FeatureMatrixTest, LayoutsAndSymbols) {
+    std::vector<MarketData> symbols = {make_symbol(3000, 0.0), make_symbol(1500, 1.0)};
+    FeatureMatrixBuilder builder = all_features();
+
+    FeatureMatrix row = builder.build(symbols, MatrixLayout::RowMajor, 2);
+    FeatureMatrix col = builder.build(symbols, MatrixLayout::ColumnMajor, 3);
+
+    ASSERT_EQ(row.symbol_offsets, (std::vector<size_t>{0, 3000, 4500}));
+    EXPECT_TRUE(std::isnan(row.at(3000, 0)));    // second symbol restarts its history
+    for (size_t i = 0; i < row.rows; i += 37) {
+        for (size_t f = 0; f < row.cols; ++f) {
+            double a = row.at(i, f);
+            double b = col.at(i, f);
+            if (std::isnan(a)) {
+                EXPECT_TRUE(std::isnan(b));
+            } else {
+                EXPECT_DOUBLE_EQ(a, b);
+            }
+        }
+    }
+    EXPECT_EQ(builder.names()[2], "rolling_vol_20");
+}
+
+// A bad input only spoils the windows holding it, not the rest of its block
+TEST(FeatureMatrixTest, BadInputOnlyAffectsItsWindows) {
+    MarketData md = make_symbol(3000, 0.0);
+    md.volume[100] = std::nan("");
+    md.close[200] = 0.0;                // log returns -inf at 200, +inf at 201
+    FeatureMatrixBuilder builder;
+    builder.add(FeatureKind::RollingVol, 20).add(FeatureKind::VolumeRatio, 10);
+
+    FeatureMatrix m = builder.build({md}, MatrixLayout::RowMajor, 2);
+
+    auto rolling_vol = [&](size_t i) {
+        double sum = 0.0, sq = 0.0;
+        for (size_t j = i - 19; j <= i; ++j) {
+            double r = std::log(md.close[j] / md.close[j - 1]);
+            sum += r;
+            sq += r * r;
+        }
+        double mean = sum / 20;
+        return std::sqrt((sq - 20 * mean * mean) / 19);
+    };
+    auto volume_ratio = [&](size_t i) {
+        double sum = 0.0;
+        for (size_t j = i - 9; j <= i; ++j) {
+            sum += md.volume[j];
+        }
+        return md.volume[i] / (sum / 10);
+    };
+
+    for (size_t i = 100; i < 110; ++i) {
+        EXPECT_TRUE(std::isnan(m.at(i, 1))) << "row " << i;
+    }
+    for (size_t i : {99ul, 110ul, 111ul, 500ul, 2047ul, 2048ul, 2999ul}) {
+        EXPECT_NEAR(m.at(i, 1), volume_ratio(i), 1e-12) << "row " << i;
+    }
+    for (size_t i = 200; i <= 220; ++i) {
+        EXPECT_TRUE(std::isnan(m.at(i, 0))) << "row " << i;
+    }
+    for (size_t i : {199ul, 221ul, 222ul, 1000ul, 2047ul, 2048ul}) {
+        EXPECT_NEAR(m.at(i, 0), rolling_vol(i), 1e-10) << "row " << i;
+    }
+}
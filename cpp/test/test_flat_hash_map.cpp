@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include "flat_hash_map.hpp"
+
+#include <random>
+#include <string>
+#include <unordered_map>
+
+using namespace execution;
+
+// Random add / cancel / lookup churn agrees with std::unordered_map
+TEST(FlatHashMapTest, MatchesUnorderedMapUnderChurn) {
+    // Arrange
+    FlatHashMap<uint64_t> map;
+    std::unordered_map<uint64_t, uint64_t> reference;
+    std::vector<uint64_t> live;
+    std::mt19937_64 rng(3);
+    uint64_t next_id = 1;
+
+    // Act
+    for (int i = 0; i < 200'000; ++i) {
+        uint64_t r = rng() % 10;
+        if (r < 5 || live.empty()) {
+            uint64_t id = next_id++;
+            ASSERT_TRUE(map.insert(id, id * 3).second);
+            reference.emplace(id, id * 3);
+            live.push_back(id);
+        } else if (r < 8) {
+            size_t k = rng() % live.size();
+            ASSERT_TRUE(map.erase(live[k]));
+            reference.erase(live[k]);
+            live[k] = live.back();
+            live.pop_back();
+        } else {
+            uint64_t id = rng() % next_id;
+            uint64_t* found = map.find(id);
+            auto it = reference.find(id);
+            ASSERT_EQ(found != nullptr, it != reference.end());
+            if (found) {
+                ASSERT_EQ(*found, it->second);
+            }
+        }
+    }
+
+    // Assert
+    EXPECT_EQ(map.size(), reference.size());
+    size_t visited = 0;
+    map.for_each([&](uint64_t key, uint64_t& value) {
+        EXPECT_EQ(reference.at(key), value);
+        ++visited;
+    });
+    EXPECT_EQ(visited, reference.size());
+    EXPECT_FALSE(map.erase(next_id + 1));
+}
+
+// 14 keys in the 16-slot table form long clusters: erasing from their middle keeps the rest reachable
+TEST(FlatHashMapTest, BackwardShiftKeepsClusterReachable) {
+    FlatHashMap<std::string> map;
+    for (uint64_t k = 1; k <= 14; ++k) {
+        map.insert(k * 1000, std::to_string(k));
+    }
+    ASSERT_EQ(map.capacity(), 16u);
+    EXPECT_FALSE(map.insert(3000, "dup").second);
+
+    for (uint64_t k = 1; k <= 14; k += 3) {
+        EXPECT_TRUE(map.erase(k * 1000));
+    }
+
+    EXPECT_EQ(map.size(), 9u);
+    for (uint64_t k = 1; k <= 14; ++k) {
+        const std::string* value = map.find(k * 1000);
+        if (k % 3 == 1) {
+            EXPECT_EQ(value, nullptr);
+        } else {
+            ASSERT_NE(value, nullptr);
+            EXPECT_EQ(*value, std::to_string(k));
+        }
+    }
+}
+
+TEST(FlatHashMapTest, ReserveAvoidsGrowth) {
+    FlatHashMap<int> map(1000);
+    size_t capacity = map.capacity();
+
+    for (uint64_t i = 0; i < 1000; ++i) {
+        map.insert(i, static_cast<int>(i));
+    }
+
+    EXPECT_EQ(map.capacity(), capacity);
+    EXPECT_EQ(capacity & (capacity - 1), 0u);   // power of two
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.contains(10));
+}
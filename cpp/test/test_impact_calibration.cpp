@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include "impact_calibration.hpp"
+
+#include <cmath>
+#include <random>
+
+using namespace execution;
+
+namespace {
+
+// Fills following cost = intercept + a * sigma_bps * participation^b, noise added by `noise`
+template <typename Noise>
+FillRecords make_fills(size_t n, double a, double b, double intercept, Noise&& noise) {
+    std::mt19937_64 rng(7);
+    std::uniform_real_distribution<double> part(1e-4, 0.2);
+    std::uniform_real_distribution<double> vol(0.005, 0.04);
+    FillRecords fills;
+    for (size_t i = 0; i < n; ++i) {
+        double adv = 1e6;
+        double p = part(rng);
+        double sigma = vol(rng);
+        double cost = intercept + a * sigma * 10000.0 * std::pow(p, b);
+        fills.size.push_back(p * adv);
+        fills.adv.push_back(adv);
+        fills.volatility.push_back(sigma);
+        fills.cost_bps.push_back(noise(rng, cost));
+    }
+    return fills;
+}
+
+} // namespace
+
+TEST(ImpactCalibrationTest, RecoversSquareRootModel) {
+    // Arrange
+    std::normal_distribution<double> eps(0.0, 1.0);
+    FillRecords fills = make_fills(200'000, 0.8, 0.5, 2.0, [&](std::mt19937_64& rng, double c) { return c + eps(rng); });
+
+    // Act
+    ImpactFit fit = calibrate_impact(fills, ImpactModelKind::SquareRoot, true, 4);
+
+    // Assert
+    EXPECT_EQ(fit.num_fills, 200'000u);
+    EXPECT_NEAR(fit.coefficient, 0.8, 0.01);
+    EXPECT_NEAR(fit.intercept_bps, 2.0, 0.05);
+    EXPECT_GT(fit.r_squared, 0.9);
+}
+
+TEST(ImpactCalibrationTest, RecoversPowerLawExponent) {
+    std::normal_distribution<double> eps(0.0, 0.1);
+    FillRecords fills = make_fills(100'000, 0.5, 0.6, 0.0, [&](std::mt19937_64& rng, double c) { return c * std::exp(eps(rng)); });
+
+    ImpactFit fit = calibrate_impact(fills, ImpactModelKind::PowerLaw);
+
+    EXPECT_NEAR(fit.exponent, 0.6, 0.01);
+    EXPECT_NEAR(fit.coefficient, 0.5, 0.02);
+    EXPECT_NEAR(predict_impact_bps(fit, 1e4, 1e6, 0.02), 0.5 * 200.0 * std::pow(0.01, 0.6), 0.1);
+}
+
+// Per-thread normal equations add up to the single-thread result; bad rows are skipped
+TEST(ImpactCalibrationTest, ThreadInvariantAndSkipsInvalid) {
+    FillRecords fills = make_fills(10'000, 1.0, 1.0, 0.0, [](std::mt19937_64&, double c) { return c; });
+    fills.size.push_back(100.0);
+    fills.adv.push_back(0.0);           // no ADV
+    fills.volatility.push_back(0.02);
+    fills.cost_bps.push_back(5.0);
+    for (double bad : {INFINITY, -INFINITY}) {
+        fills.size.push_back(100.0);
+        fills.adv.push_back(1e6);
+        fills.volatility.push_back(0.02);
+        fills.cost_bps.push_back(bad);      // infinite cost
+        fills.size.push_back(INFINITY);
+        fills.adv.push_back(INFINITY);      // inf / inf participation
+        fills.volatility.push_back(0.02);
+        fills.cost_bps.push_back(5.0);
+    }
+    fills.size.push_back(100.0);
+    fills.adv.push_back(1e6);
+    fills.volatility.push_back(INFINITY);
+    fills.cost_bps.push_back(5.0);
+
+    ImpactFit one = calibrate_impact(fills, ImpactModelKind::Linear, false, 1);
+    ImpactFit many = calibrate_impact(fills, ImpactModelKind::Linear, false, 8);
+
+    EXPECT_EQ(one.num_fills, 10'000u);
+    EXPECT_NEAR(one.coefficient, 1.0, 1e-9);
+    EXPECT_NEAR(many.coefficient, one.coefficient, 1e-9);
+}
+
+// No intercept: R^2 is 1 - SSE / sum(y^2), not against the mean, so it stays in [0, 1]
+TEST(ImpactCalibrationTest, UncenteredRSquaredWithoutIntercept) {
+    std::normal_distribution<double> eps(0.0, 3.0);
+    FillRecords fills = make_fills(5'000, 0.8, 0.5, 4.0, [&](std::mt19937_64& rng, double c) { return c + eps(rng); });
+
+    ImpactFit fit = calibrate_impact(fills, ImpactModelKind::SquareRoot, false, 3);
+
+    double sse = 0.0;
+    double yty = 0.0;
+    for (size_t i = 0; i < fills.count(); ++i) {
+        double y = fills.cost_bps[i];
+        double r = y - predict_impact_bps(fit, fills.size[i], fills.adv[i], fills.volatility[i]);
+        sse += r * r;
+        yty += y * y;
+    }
+    EXPECT_NEAR(fit.r_squared, 1.0 - sse / yty, 1e-9);
+    EXPECT_GE(fit.r_squared, 0.0);
+    EXPECT_LE(fit.r_squared, 1.0);
+}
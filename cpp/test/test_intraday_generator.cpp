@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include "intraday_generator.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace execution;
+
+namespace {
+
+MarketData make_daily(size_t n) {
+    MarketData daily;
+    for (size_t i = 0; i < n; ++i) {
+        double o = 100.0 + std::sin(0.3 * i);
+        double c = o * (1.0 + 0.01 * std::cos(0.7 * i));
+        double h = std::max(o, c) * 1.012;
+        double l = std::min(o, c) * 0.991;
+        daily.push_back(20200101 + static_cast<int64_t>(i), o, h, l, c, 1e6 + 1e4 * i);
+    }
+    return daily;
+}
+
+} // namespace
+
+// Minute bars reproduce the daily bar exactly
+TEST(IntradayGeneratorTest, ConsistentWithDailyBar) {
+    // Arrange
+    MarketData daily = make_daily(50);
+    IntradayBarGenerator generator(daily);
+    MarketData bars;
+
+    for (size_t d = 0; d < daily.size(); ++d) {
+        // Act
+        generator.generate_day(d, bars);
+
+        // Assert
+        ASSERT_EQ(bars.size(), 390u);
+        EXPECT_DOUBLE_EQ(bars.open.front(), daily.open[d]);
+        EXPECT_DOUBLE_EQ(bars.close.back(), daily.close[d]);
+        EXPECT_DOUBLE_EQ(*std::max_element(bars.high.begin(), bars.high.end()), daily.high[d]);
+        EXPECT_DOUBLE_EQ(*std::min_element(bars.low.begin(), bars.low.end()), daily.low[d]);
+        double volume = 0.0;
+        for (double v : bars.volume) volume += v;
+        EXPECT_NEAR(volume, daily.volume[d], 1e-6 * daily.volume[d]);
+    }
+    // 20200150 is day 49 after 2020-01-01 (18262 days after the epoch), 09:30
+    EXPECT_EQ(bars.timestamps.front(), (18262 + 49) * IntradayBarGenerator::DAY_NS + 570 * IntradayBarGenerator::MINUTE_NS);
+    EXPECT_EQ(bars.timestamps[1] - bars.timestamps[0], IntradayBarGenerator::MINUTE_NS);
+    EXPECT_GT(bars.volume.front(), bars.volume[195]);    // U-shaped profile
+}
+
+// Counter-based randomness: same bars whatever the thread count / order
+TEST(IntradayGeneratorTest, DeterministicAcrossThreads) {
+    MarketData daily = make_daily(200);
+    IntradayConfig single;
+    single.num_threads = 1;
+    IntradayConfig multi;
+    multi.num_threads = 8;
+
+    std::vector<double> a = intraday_twap_slippage(daily, 10, single);
+    std::vector<double> b = intraday_twap_slippage(daily, 10, multi);
+
+    ASSERT_EQ(a.size(), 200u);
+    for (size_t d = 0; d < a.size(); ++d) {
+        EXPECT_DOUBLE_EQ(a[d], b[d]);
+    }
+}
+
+// Early rows of SP500.csv have O = H = L = C and no volume
+TEST(IntradayGeneratorTest, FlatDay) {
+    MarketData daily;
+    daily.push_back(19280103, 17.76, 17.76, 17.76, 17.76, 0.0);
+    IntradayBarGenerator generator(daily);
+    MarketData bars;
+
+    generator.generate_day(0, bars);
+
+    EXPECT_DOUBLE_EQ(*std::max_element(bars.high.begin(), bars.high.end()), 17.76);
+    EXPECT_DOUBLE_EQ(*std::min_element(bars.low.begin(), bars.low.end()), 17.76);
+    EXPECT_DOUBLE_EQ(bars.volume[10], 0.0);
+}
+
+// A session longer than 09:30 -> midnight would spill into the next day
+TEST(IntradayGeneratorTest, SessionEndsByMidnight) {
+    MarketData daily = make_daily(3);
+    IntradayConfig config;
+    config.minutes_per_day = IntradayBarGenerator::MAX_MINUTES;
+    IntradayBarGenerator generator(daily, config);
+    MarketData bars;
+
+    generator.generate_day(0, bars);
+
+    int64_t midnight = bars.timestamps.front() - 570 * IntradayBarGenerator::MINUTE_NS + IntradayBarGenerator::DAY_NS;
+    EXPECT_EQ(bars.timestamps.back() + IntradayBarGenerator::MINUTE_NS, midnight);    // last bar closes at 24:00
+    config.minutes_per_day = IntradayBarGenerator::MAX_MINUTES + 1;
+    EXPECT_THROW(IntradayBarGenerator(daily, config), std::invalid_argument);
+}
+
+// Depth below -1 would give negative minute volumes
+TEST(IntradayGeneratorTest, VolumeDepthBounded) {
+    MarketData daily = make_daily(3);
+    IntradayConfig config;
+
+    config.volume_u_depth = -1.0;
+    EXPECT_NO_THROW(IntradayBarGenerator(daily, config));
+    config.volume_u_depth = -3.0;
+    EXPECT_THROW(IntradayBarGenerator(daily, config), std::invalid_argument);
+    config.volume_u_depth = std::nan("");
+    EXPECT_THROW(IntradayBarGenerator(daily, config), std::invalid_argument);
+}
+
+// Columns shorter than close would be read past their end
+TEST(IntradayGeneratorTest, MismatchedColumnsThrow) {
+    MarketData close_only;
+    close_only.close = {100.0, 101.0};
+    MarketData short_volume = make_daily(5);
+    short_volume.volume.pop_back();
+    MarketData short_dates = make_daily(5);
+    short_dates.timestamps.pop_back();
+    MarketData no_dates = make_daily(5);
+    no_dates.timestamps.clear();
+
+    EXPECT_THROW(IntradayBarGenerator{close_only}, std::invalid_argument);
+    EXPECT_THROW(IntradayBarGenerator{short_volume}, std::invalid_argument);
+    EXPECT_THROW(IntradayBarGenerator{short_dates}, std::invalid_argument);
+    EXPECT_THROW(intraday_twap_slippage(close_only, 10), std::invalid_argument);
+    EXPECT_NO_THROW(IntradayBarGenerator{no_dates});
+}
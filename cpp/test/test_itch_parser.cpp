@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include "itch_parser.hpp"
+
+#include <random>
+#include <vector>
+
+using namespace execution;
+
+TEST(OrderBookTest, LevelsFollowOrderEvents) {
+    // Arrange
+    OrderBook book;
+    book.add(1, Side::Buy, 100'0000, 300);
+    book.add(2, Side::Buy, 100'0000, 200);
+    book.add(3, Side::Buy, 99'9900, 100);
+    book.add(4, Side::Sell, 100'0100, 500);
+
+    // Act
+    uint32_t executed = book.execute(1, 1000);      // capped at the resting size
+    book.cancel(2, 50);
+    book.replace(4, 5, 100'0200, 400);
+
+    // Assert
+    EXPECT_EQ(executed, 300u);
+    EXPECT_EQ(book.find(1), nullptr);
+    EXPECT_EQ(book.best_bid(), 100'0000);
+    EXPECT_EQ(book.level(Side::Buy, 100'0000).quantity, 150u);
+    EXPECT_EQ(book.level(Side::Buy, 100'0000).num_orders, 1u);
+    EXPECT_EQ(book.best_ask(), 100'0200);
+    EXPECT_EQ(book.find(5)->side, Side::Sell);
+    EXPECT_EQ(book.num_levels(Side::Sell), 1u);
+    EXPECT_FALSE(book.add(3, Side::Sell, 1, 1));    // duplicate id
+    EXPECT_EQ(book.execute(42, 10), 0u);            // unknown id
+}
+
+TEST(OrderBookTest, FailedReplaceLeavesBookUnchanged) {
+    // Arrange
+    OrderBook book;
+    book.add(1, Side::Buy, 100'0000, 300);
+    book.add(2, Side::Buy, 99'9900, 200);
+
+    // Act
+    bool duplicate = book.replace(1, 2, 100'0100, 400);    // new id already resting
+    bool same_id = book.replace(1, 1, 100'0100, 400);
+
+    // Assert
+    EXPECT_FALSE(duplicate);
+    EXPECT_FALSE(same_id);
+    ASSERT_NE(book.find(1), nullptr);
+    EXPECT_EQ(book.find(1)->price, 100'0000);
+    EXPECT_EQ(book.find(2)->price, 99'9900);
+    EXPECT_EQ(book.level(Side::Buy, 100'0000).quantity, 300u);
+    EXPECT_EQ(book.level(Side::Buy, 99'9900).num_orders, 1u);
+    EXPECT_EQ(book.num_levels(Side::Buy), 2u);
+}
+
+// Generated sample file -> mmap -> parser -> books matches applying the same events directly
+TEST(ItchParserTest, SampleFileReplay) {
+    ItchWriter writer;
+    std::vector<OrderBook> expected(3);
+    std::vector<std::pair<uint16_t, uint64_t>> live;
+    std::mt19937_64 rng(11);
+    uint64_t next_ref = 1;
+    uint64_t ts = 34'200'000'000'000;   // 09:30 in ns since midnight
+
+    for (int i = 0; i < 20'000; ++i) {
+        ts += 1000;
+        int action = live.empty() ? 0 : static_cast<int>(rng() % 5);
+        if (action <= 1) {
+            uint16_t locate = static_cast<uint16_t>(rng() % 3);
+            Side side = rng() % 2 ? Side::Buy : Side::Sell;
+            uint32_t price = (side == Side::Buy ? 99'0000 : 101'0000) + static_cast<uint32_t>(rng() % 20) * 100;
+            uint32_t shares = 100 * (1 + static_cast<uint32_t>(rng() % 10));
+            writer.add(locate, ts, next_ref, side, shares, price, "AAPL");
+            expected[locate].add(next_ref, side, price, shares);
+            live.emplace_back(locate, next_ref++);
+            continue;
+        }
+        size_t k = rng() % live.size();
+        auto [locate, ref] = live[k];
+        if (action == 2) {
+            writer.execute(locate, ts, ref, 100, static_cast<uint64_t>(i));
+            expected[locate].execute(ref, 100);
+        } else if (action == 3) {
+            writer.cancel(locate, ts, ref, 100);
+            expected[locate].cancel(ref, 100);
+        } else {
+            uint32_t price = expected[locate].find(ref) ? static_cast<uint32_t>(expected[locate].find(ref)->price) : 100'0000;
+            writer.replace(locate, ts, ref, next_ref, 300, price);
+            expected[locate].replace(ref, next_ref, price, 300);
+            live[k].second = next_ref++;
+        }
+        if (!expected[locate].find(live[k].second)) {
+            writer.remove(locate, ts, live[k].second);     // already gone: exercises unknown refs
+            live[k] = live.back();
+            live.pop_back();
+        }
+    }
+    std::string path = ::testing::TempDir() + "itch_sample.bin";
+    writer.save(path);
+
+    ItchBookReplay replay;
+    ItchStats stats = parse_itch_file(path, replay);
+
+    EXPECT_FALSE(stats.truncated);
+    EXPECT_EQ(stats.bytes, writer.bytes().size());
+    EXPECT_EQ(stats.skipped, 0u);
+    EXPECT_EQ(stats.messages, stats.adds + stats.executes + stats.cancels + stats.deletes + stats.replaces);
+    EXPECT_EQ(replay.unknown_refs(), stats.deletes);
+    ASSERT_EQ(replay.num_books(), 3u);
+    for (uint16_t locate = 0; locate < 3; ++locate) {
+        const OrderBook& book = replay.book(locate);
+        EXPECT_EQ(book.num_orders(), expected[locate].num_orders());
+        EXPECT_EQ(book.best_bid(), expected[locate].best_bid());
+        EXPECT_EQ(book.best_ask(), expected[locate].best_ask());
+        EXPECT_EQ(book.level(Side::Buy, book.best_bid()).quantity,
+                  expected[locate].level(Side::Buy, book.best_bid()).quantity);
+    }
+
+    // A book handed out earlier survives new locates being added
+    const OrderBook& first = replay.book(0);
+    replay.on_add(ItchAdd{4'000, 0, 1'000'000, Side::Buy, 100, 10'0000, {}});
+    EXPECT_EQ(&first, &replay.book(0));
+    EXPECT_EQ(first.num_orders(), expected[0].num_orders());
+}
+
+namespace {
+
+// Only hooks adds: everything else is counted but not decoded
+struct AddCounter {
+    uint64_t shares = 0;
+    char stock[8] = {};
+    void on_add(const ItchAdd& m) {
+        shares += m.shares;
+        std::memcpy(stock, m.stock, sizeof(stock));
+    }
+};
+
+} // namespace
+
+TEST(ItchParserTest, PartialHandlerAndTruncatedStream) {
+    ItchWriter writer;
+    writer.add(7, 1, 1, Side::Sell, 250, 10'0000, "MSFT");
+    writer.execute(7, 2, 1, 50, 1);
+    std::vector<uint8_t> bytes = writer.bytes();
+    bytes.insert(bytes.end(), {0x00, 0x03, 'S', 0x00, 0x01});  // system event, unknown here
+    bytes.insert(bytes.end(), {0x00, 0x24, 'A', 0x00});        // cut mid-message
+
+    AddCounter counter;
+    ItchStats stats = parse_itch(bytes.data(), bytes.size(), counter);
+
+    EXPECT_EQ(stats.messages, 3u);
+    EXPECT_EQ(stats.executes, 1u);
+    EXPECT_EQ(stats.skipped, 1u);
+    EXPECT_TRUE(stats.truncated);
+    EXPECT_EQ(counter.shares, 250u);
+    EXPECT_EQ(std::string(counter.stock, 8), "MSFT    ");
+    EXPECT_THROW(MappedFile("/nonexistent/itch.bin"), std::runtime_error);
+}
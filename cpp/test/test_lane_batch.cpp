@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include "lane_batch.hpp"
+#include "kernels.hpp"
+#include "synthetic_history.hpp"
+
+#include <cmath>
+#include <random>
+
+using namespace execution;
+
+namespace {
+
+// Windows without volume fall back to TWAP, plus bad volumes the kernels must tolerate
+void make_history(size_t n, std::vector<double>& prices, std::vector<double>& volumes) {
+    random_walk(n, 9, 53, 9, prices, volumes);
+    volumes[20] = std::nan("");
+    volumes[21] = -5.0;
+}
+
+} // namespace
+
+TEST(LaneBatchTest, MatchesScalarKernelsForEveryLaneWidth) {
+    std::vector<double> prices, volumes;
+    make_history(2000, prices, volumes);
+    std::mt19937_64 rng(4);
+    const size_t num_slices = 10;
+
+    std::vector<size_t> starts(203);      // not a multiple of any lane width: exercises the tail
+    for (size_t& s : starts) {
+        s = rng() % (prices.size() - num_slices + 1);
+    }
+    starts[0] = 0;
+    starts[1] = prices.size() - num_slices;
+    starts[2] = 15;                       // covers the NaN and negative volume
+
+    for (size_t lanes : {4, 8, 16}) {
+        BatchSlippage out = batch_slippage(prices, volumes, starts, num_slices, "sell", lanes, 2);
+        ASSERT_EQ(out.twap_bps.size(), starts.size());
+        for (size_t i = 0; i < starts.size(); ++i) {
+            const double* p = prices.data() + starts[i];
+            const double* v = volumes.data() + starts[i];
+            EXPECT_NEAR(out.twap_bps[i], slippage_bps(twap_avg_price(p, num_slices), p[0], -1.0), 1e-9);
+            EXPECT_NEAR(out.vwap_bps[i], slippage_bps(vwap_avg_price(p, v, num_slices), p[0], -1.0), 1e-9);
+        }
+    }
+}
+
+// Bars cleaned at load: unclamped lanes and mask-driven tail, same results
+TEST(LaneBatchTest, CleanDataMatchesRawColumns) {
+    std::vector<double> prices, volumes;
+    make_history(600, prices, volumes);
+    MarketData bars;
+    for (size_t i = 0; i < prices.size(); ++i) {
+        bars.push_back(static_cast<int64_t>(i), prices[i], prices[i], prices[i], prices[i], volumes[i]);
+    }
+    CleanData data = clean_market_data(bars);
+    std::vector<size_t> starts;
+    for (size_t s = 0; s + 8 <= prices.size(); s += 7) {
+        starts.push_back(s);
+    }
+
+    BatchSlippage raw = batch_slippage(prices, volumes, starts, 8, "buy", 8);
+    BatchSlippage clean = batch_slippage(data, starts, 8, "buy", 8);
+    for (size_t i = 0; i < starts.size(); ++i) {
+        EXPECT_NEAR(clean.twap_bps[i], raw.twap_bps[i], 1e-9);
+        EXPECT_NEAR(clean.vwap_bps[i], raw.vwap_bps[i], 1e-9) << "start " << starts[i];
+    }
+
+    CleanConfig keep;
+    keep.volume_nan = NanPolicy::Keep;
+    EXPECT_THROW(batch_slippage(clean_market_data(bars, keep), starts, 8), std::invalid_argument);
+}
+
+TEST(LaneBatchTest, RejectsBadInput) {
+    std::vector<double> prices(50, 100.0), volumes(50, 1.0);
+    EXPECT_THROW(batch_slippage(prices, volumes, {41}, 10), std::out_of_range);
+    EXPECT_THROW(batch_slippage(prices, volumes, {0}, 10, "buy", 6), std::invalid_argument);
+    EXPECT_THROW(batch_slippage(prices, volumes, {0}, 0), std::invalid_argument);
+    EXPECT_TRUE(batch_slippage(prices, volumes, {}, 10).twap_bps.empty());
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include "limit_strategy.hpp"
+
+#include <deque>
+
+using namespace execution;
+
+namespace {
+
+constexpr int64_t BID = 100'0000;
+constexpr int64_t ASK = 100'0200;
+
+// Static 1000-share offer; the bid queue is refilled and hit 100 shares at a time, FIFO
+std::vector<TapeEvent> make_tape(size_t steps) {
+    ItchWriter feed;
+    std::deque<uint64_t> bids;
+    uint64_t ref = 1;
+    feed.add(0, 0, ref++, Side::Sell, 1000, ASK);
+    for (int i = 0; i < 5; ++i) {
+        feed.add(0, 0, ref, Side::Buy, 100, BID);
+        bids.push_back(ref++);
+    }
+    for (size_t i = 1; i <= steps; ++i) {
+        feed.add(0, i * 1000, ref, Side::Buy, 100, BID);
+        bids.push_back(ref++);
+        feed.execute(0, i * 1000, bids.front(), 100, i);
+        bids.pop_front();
+    }
+    BookTape tape;
+    parse_itch(feed.bytes().data(), feed.bytes().size(), tape);
+    return tape.events();
+}
+
+PlacementConfig make_config() {
+    PlacementConfig config;
+    config.side = Side::Buy;
+    config.quantity = 2000;
+    config.start_time = 1000;
+    config.end_time = 1'001'000;
+    config.num_slices = 4;
+    return config;
+}
+
+} // namespace
+
+TEST(BookTapeTest, RecordsTouchAfterEachEvent) {
+    std::vector<TapeEvent> tape = make_tape(10);
+
+    ASSERT_EQ(tape.size(), 6u + 2 * 10);
+    const TapeEvent& last = tape.back();
+    EXPECT_EQ(last.kind, TapeEventKind::Execute);
+    EXPECT_EQ(last.side, Side::Buy);
+    EXPECT_EQ(last.best_bid, BID);
+    EXPECT_EQ(last.best_ask, ASK);
+    EXPECT_EQ(last.bid_size, 500u);
+    EXPECT_EQ(last.level_before, 600u);
+}
+
+TEST(BookTapeTest, RejectedReplaceRecordsNothing) {
+    ItchWriter feed;
+    feed.add(0, 0, 1, Side::Buy, 100, BID);
+    feed.add(0, 0, 2, Side::Sell, 100, ASK);
+    feed.replace(0, 1, 1, 2, 100, BID);            // new ref already resting
+    feed.replace(0, 2, 1, 1, 100, BID);            // same ref
+    feed.replace(0, 3, 1, 3, 200, BID);
+    BookTape tape;
+    parse_itch(feed.bytes().data(), feed.bytes().size(), tape);
+
+    ASSERT_EQ(tape.events().size(), 4u);           // two adds, then one delete + add
+    EXPECT_EQ(tape.events()[2].kind, TapeEventKind::Cancel);
+    EXPECT_EQ(tape.events()[2].timestamp, 3u);
+    EXPECT_EQ(tape.events()[3].bid_size, 200u);
+}
+
+// Patient placement earns the spread, immediate escalation pays it
+TEST(LimitStrategyTest, PassiveVersusAggressive) {
+    // Arrange
+    std::vector<TapeEvent> tape = make_tape(1000);
+    std::vector<PlacementParams> params = {{1.0, 0.0}, {0.0, 0.0}, {0.9, 2.0}};
+
+    // Act
+    std::vector<PlacementResult> results = sweep_limit_strategy(tape, make_config(), params);
+
+    // Assert
+    const PlacementResult& patient = results[0];
+    EXPECT_EQ(patient.filled, 2000u);
+    EXPECT_EQ(patient.passive_filled, 2000u);
+    EXPECT_DOUBLE_EQ(patient.avg_price, BID);
+    EXPECT_NEAR(patient.slippage_bps, -1.0, 1e-3);
+    EXPECT_NEAR(patient.spread_capture_bps, 1.0, 1e-3);
+
+    const PlacementResult& eager = results[1];
+    EXPECT_EQ(eager.filled, 2000u);
+    EXPECT_EQ(eager.passive_filled, 0u);
+    EXPECT_DOUBLE_EQ(eager.avg_price, ASK);
+    EXPECT_NEAR(eager.slippage_bps, 1.0, 1e-3);
+
+    // 500 ahead > 2 * 500 remaining is false: still passive
+    EXPECT_EQ(results[2].passive_filled, 2000u);
+}
+
+// Thousands of parameterizations in one sweep, independent of the thread split
+// No offer to lift: escalations find no far touch, nothing disappears
+TEST(LimitStrategyTest, EmptyFarSideCountsUnfilled) {
+    ItchWriter feed;
+    for (uint64_t i = 1; i <= 20; ++i) {
+        feed.add(0, i * 50'000, i, Side::Buy, 100, BID);
+    }
+    BookTape tape;
+    parse_itch(feed.bytes().data(), feed.bytes().size(), tape);
+
+    std::vector<PlacementResult> results = sweep_limit_strategy(tape.events(), make_config(), {{0.0, 0.0}, {0.8, 0.0}});
+
+    for (const PlacementResult& r : results) {
+        EXPECT_EQ(r.filled, 0u);
+        EXPECT_EQ(r.unfilled, 2000u);
+    }
+}
+
+TEST(LimitStrategyTest, BatchedSweepIsThreadInvariant) {
+    std::vector<TapeEvent> tape = make_tape(2000);
+    PlacementConfig config = make_config();
+    config.end_time = 2'001'000;
+    config.num_slices = 7;
+    config.quantity = 3333;
+    std::vector<PlacementParams> params;
+    for (int i = 0; i < 2000; ++i) {
+        params.push_back({(i % 100) / 100.0, (i / 100) * 0.05});
+    }
+
+    config.num_threads = 1;
+    std::vector<PlacementResult> one = sweep_limit_strategy(tape, config, params);
+    config.num_threads = 8;
+    std::vector<PlacementResult> many = sweep_limit_strategy(tape, config, params);
+
+    ASSERT_EQ(one.size(), params.size());
+    for (size_t p = 0; p < params.size(); ++p) {
+        EXPECT_EQ(one[p].filled, 3333u);
+        EXPECT_EQ(one[p].unfilled, 0u);
+        EXPECT_EQ(one[p].passive_filled, many[p].passive_filled);
+        EXPECT_DOUBLE_EQ(one[p].avg_price, many[p].avg_price);
+    }
+    EXPECT_GT(one[99].passive_filled, one[0].passive_filled);  // later escalation, more passive
+}
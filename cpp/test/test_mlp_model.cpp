@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include "mlp_model.hpp"
+#include "mlp_policy.hpp"
+
+#include <cmath>
+#include <sstream>
+
+using namespace execution;
+
+namespace {
+
+// 4 -> 3 relu -> 1 sigmoid
+const char* TINY_MODEL = R"(mlp
+dense 4 3 relu
+ 0.5 -0.2  0.1  0.0
+-0.3  0.8  0.0  0.4
+ 0.2  0.2  0.2  0.2
+ 0.1 -0.1  0.05
+dense 3 1 sigmoid
+ 1.0 -0.5 0.25
+ 0.1
+)";
+
+MLPModel tiny_model() {
+    std::istringstream in(TINY_MODEL);
+    return MLPModel::parse(in);
+}
+
+} // namespace
+
+TEST(MLPModelTest, PredictMatchesManual) {
+    MLPModel model = tiny_model();
+    float x[4] = {1.0f, 2.0f, -1.0f, 0.5f};
+
+    float y = model.predict(x);
+
+    double h0 = std::max(0.0, 0.5 - 0.4 - 0.1 + 0.0 + 0.1);
+    double h1 = std::max(0.0, -0.3 + 1.6 + 0.0 + 0.2 - 0.1);
+    double h2 = std::max(0.0, 0.2 + 0.4 - 0.2 + 0.1 + 0.05);
+    double expected = 1.0 / (1.0 + std::exp(-(h0 - 0.5 * h1 + 0.25 * h2 + 0.1)));
+    EXPECT_EQ(model.input_dim(), 4u);
+    EXPECT_NEAR(y, expected, 1e-6);
+}
+
+// Lane-tiled batch path agrees with single-row inference, including the ragged tail
+TEST(MLPModelTest, BatchMatchesSingle) {
+    MLPModel model = tiny_model();
+    const size_t n = 19;
+    std::vector<float> x(n * 4);
+    for (size_t i = 0; i < x.size(); ++i) {
+        x[i] = std::sin(0.37f * i);
+    }
+
+    std::vector<float> batch(n);
+    model.predict_batch(x.data(), n, batch.data());
+
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_NEAR(batch[i], model.predict(x.data() + i * 4), 1e-6) << "row " << i;
+    }
+}
+
+TEST(MLPModelTest, RejectsBadFiles) {
+    std::istringstream truncated("mlp\ndense 2 2 relu\n1 2 3\n");
+    std::istringstream too_wide("mlp\ndense 4 4000000000 relu\n");
+
+    EXPECT_THROW(MLPModel::parse(truncated), std::runtime_error);
+    EXPECT_THROW(MLPModel::parse(too_wide), std::runtime_error);
+    EXPECT_THROW(MLPModel::load("/nonexistent/model.txt"), std::runtime_error);
+}
+
+// Default-constructed model has nothing to run: throws instead of reading an unset output
+TEST(MLPModelTest, EmptyModelThrows) {
+    MLPModel model;
+    float x[1] = {1.0f};
+    float out[1] = {0.0f};
+
+    EXPECT_EQ(model.num_layers(), 0u);
+    EXPECT_THROW(model.predict(x), std::runtime_error);
+    EXPECT_THROW(model.predict(x, out), std::runtime_error);
+    EXPECT_THROW(model.predict_batch(x, 1, out), std::runtime_error);
+    EXPECT_THROW(MLPModel(std::vector<DenseLayer>{}), std::invalid_argument);
+}
+
+// Batched backtest path reproduces the per-order loop
+TEST(MLPPolicyTest, BatchedBacktestMatchesLoop) {
+    // Arrange
+    MLPModel model = tiny_model();
+    std::vector<double> prices(200), volumes(200);
+    for (size_t i = 0; i < prices.size(); ++i) {
+        prices[i] = 100.0 + 3.0 * std::sin(0.2 * i);
+        volumes[i] = 1e6 * (1.2 + std::cos(0.1 * i));
+    }
+    Order order(10'000.0, "buy", 10);
+
+    // Act
+    std::vector<double> batched = mlp_policy_slippage(prices, volumes, order, model, 3);
+    ExecutionResult single = execute_mlp_policy(prices, volumes, order, 57, model);
+    ExecutionResult early = execute_mlp_policy(prices, volumes, order, 15, model);    // crosses the first full volume window
+
+    // Assert
+    double executed = 0.0;
+    for (const auto& s : single.slices) {
+        executed += s.size;
+    }
+    ASSERT_EQ(batched.size(), 191u);
+    EXPECT_NEAR(executed, order.size, 1e-6);
+    EXPECT_NEAR(batched[57], single.slippage_bps, 1e-6);
+    EXPECT_NEAR(batched[15], early.slippage_bps, 1e-6);
+}
+
+// Finite weights whose output is NaN (3e38 * +-10 overflows to +-inf, then inf - inf):
+// every slice holds and the whole order trades on the last one
+TEST(MLPPolicyTest, NaNOutputHolds) {
+    std::istringstream in(R"(mlp
+dense 4 1 linear
+ 0 0 0 0
+ 3e38
+dense 1 2 linear
+ 10
+-10
+ 0 0
+dense 2 1 linear
+ 1 1
+ 0
+)");
+    MLPModel model = MLPModel::parse(in);
+    std::vector<double> prices(60), volumes(60, 1e6);
+    for (size_t i = 0; i < prices.size(); ++i) {
+        prices[i] = 100.0 + 3.0 * std::sin(0.2 * i);
+    }
+    Order order(10'000.0, "buy", 10);
+    float x[4] = {1.0f, 1.0f, 0.0f, 1.0f};
+    ASSERT_TRUE(std::isnan(model.predict(x)));
+
+    std::vector<double> batched = mlp_policy_slippage(prices, volumes, order, model, 2);
+    ExecutionResult single = execute_mlp_policy(prices, volumes, order, 30, model);
+
+    double expected = (prices[39] - prices[30]) / prices[30] * 10000.0;
+    EXPECT_EQ(single.slices.front().size, 0.0);
+    EXPECT_DOUBLE_EQ(single.slices.back().size, order.size);
+    EXPECT_NEAR(single.slippage_bps, expected, 1e-9);
+    EXPECT_NEAR(batched[30], expected, 1e-9);
+    for (double s : batched) {
+        EXPECT_TRUE(std::isfinite(s));
+    }
+}
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include "oms.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace execution;
+
+namespace {
+
+ExecutionReport report(const ChildOrder* child, ReportType type, uint32_t quantity = 0, int64_t price = 0) {
+    return ExecutionReport{child->id, type, quantity, price, 0};
+}
+
+} // namespace
+
+TEST(OrderStateTest, TransitionTable) {
+    OrderState s = OrderState::New;
+    EXPECT_TRUE(transition(s, OrderEvent::PartialFill));     // fill racing ahead of the ack
+    EXPECT_EQ(s, OrderState::PartiallyFilled);
+    EXPECT_TRUE(transition(s, OrderEvent::Ack));             // the late ack changes nothing
+    EXPECT_EQ(s, OrderState::PartiallyFilled);
+    EXPECT_FALSE(transition(s, OrderEvent::Reject));
+    EXPECT_TRUE(transition(s, OrderEvent::FullFill));
+    EXPECT_EQ(s, OrderState::Filled);
+
+    for (OrderState terminal : {OrderState::Filled, OrderState::Cancelled, OrderState::Rejected}) {
+        for (size_t e = 0; e < NUM_ORDER_EVENTS; ++e) {
+            OrderState t = terminal;
+            bool late_ack = terminal == OrderState::Filled && static_cast<OrderEvent>(e) == OrderEvent::Ack;
+            EXPECT_EQ(transition(t, static_cast<OrderEvent>(e)), late_ack);
+            EXPECT_EQ(t, terminal);
+        }
+    }
+}
+
+TEST(OrderManagerTest, ReportsDriveChildAndParent) {
+    OrderManager oms(8, 64, 64);
+    ParentOrder* parent = oms.new_parent(Order(1000, "sell", 4));
+    ASSERT_NE(parent, nullptr);
+    EXPECT_EQ(parent->side, Side::Sell);
+
+    ChildOrder* a = oms.send_child(parent->id, 100, 600);
+    ChildOrder* b = oms.send_child(parent->id, 101, 400);
+    EXPECT_EQ(oms.send_child(parent->id, 101, 1), nullptr);  // fully allocated
+    EXPECT_EQ(parent->unallocated(), 0u);
+
+    EXPECT_TRUE(oms.apply(report(a, ReportType::Ack)));
+    EXPECT_EQ(parent->state, OrderState::Acked);
+    EXPECT_TRUE(oms.apply(report(a, ReportType::Fill, 200, 100)));
+    EXPECT_TRUE(oms.apply(report(b, ReportType::Reject)));
+    EXPECT_EQ(a->state, OrderState::PartiallyFilled);
+    EXPECT_EQ(b->state, OrderState::Rejected);
+    EXPECT_EQ(parent->state, OrderState::PartiallyFilled);
+    EXPECT_EQ(oms.remaining(parent->id), 800u);
+    EXPECT_EQ(parent->unallocated(), 400u);                  // the rejected quantity is free again
+
+    ChildOrder* c = oms.send_child(parent->id, 99, 400);
+    EXPECT_TRUE(oms.apply(report(c, ReportType::Fill, 400, 99)));
+    EXPECT_TRUE(oms.apply(report(a, ReportType::Fill, 500, 101)));  // capped at a's 400 remaining
+    EXPECT_EQ(a->state, OrderState::Filled);
+    EXPECT_EQ(parent->state, OrderState::Filled);
+    EXPECT_EQ(parent->remaining(), 0u);
+    EXPECT_DOUBLE_EQ(parent->avg_price(), (200 * 100 + 400 * 99 + 400 * 101) / 1000.0);
+
+    EXPECT_FALSE(oms.apply(report(a, ReportType::Cancel)));  // too late
+    EXPECT_TRUE(oms.apply(report(c, ReportType::Ack)));      // filled before its ack: not a violation
+    EXPECT_EQ(c->state, OrderState::Filled);
+    EXPECT_FALSE(oms.apply(ExecutionReport{999, ReportType::Ack}));
+    EXPECT_EQ(oms.stats().invalid_transitions, 1u);
+    EXPECT_EQ(oms.stats().unknown_orders, 1u);
+
+    uint64_t id = parent->id;
+    EXPECT_TRUE(oms.release_parent(id));
+    EXPECT_EQ(oms.find_parent(id), nullptr);
+    EXPECT_EQ(oms.num_children(), 0u);
+    EXPECT_EQ(oms.child_store().num_fills(), 0u);
+}
+
+// Sizes that would wrap, truncate or round to nothing are rejected before the cast
+TEST(OrderManagerTest, RejectsUnrepresentableSizes) {
+    OrderManager oms(8, 8, 8);
+
+    for (double size : {-100.0, 0.0, 0.4, std::nan(""), HUGE_VAL, 5e9}) {
+        EXPECT_THROW(oms.new_parent(Order(size, "buy", 4)), std::invalid_argument) << size;
+    }
+    ParentOrder* largest = oms.new_parent(Order(4294967295.0, "buy", 4));
+    ASSERT_NE(largest, nullptr);
+    EXPECT_EQ(largest->remaining(), 4294967295u);
+    EXPECT_EQ(oms.new_parent(Order(99.6, "sell", 4))->remaining(), 100u);
+}
+
+TEST(OrderManagerTest, CancelParentWaitsForOpenChildren) {
+    OrderManager oms(4, 16, 16);
+    ParentOrder* parent = oms.new_parent(Side::Buy, 500);
+    ChildOrder* a = oms.send_child(parent->id, 100, 200);
+    ChildOrder* b = oms.send_child(parent->id, 100, 200);
+    oms.apply(report(a, ReportType::Ack));
+    oms.apply(report(a, ReportType::Fill, 50, 100));
+
+    EXPECT_EQ(oms.cancel_parent(parent->id), 2);
+    EXPECT_EQ(oms.send_child(parent->id, 100, 100), nullptr);
+    EXPECT_FALSE(oms.release_parent(parent->id));            // not terminal yet
+
+    oms.apply(report(a, ReportType::Cancel));
+    EXPECT_EQ(parent->state, OrderState::PartiallyFilled);
+    oms.apply(report(b, ReportType::Fill, 200, 101));
+    EXPECT_EQ(parent->state, OrderState::Cancelled);
+    EXPECT_EQ(parent->filled, 250u);
+    EXPECT_EQ(parent->open, 0u);
+
+    ParentOrder* idle = oms.new_parent(Side::Sell, 100);
+    EXPECT_EQ(oms.cancel_parent(idle->id), 0);
+    EXPECT_EQ(idle->state, OrderState::Cancelled);
+    EXPECT_EQ(oms.cancel_parent(idle->id), -1);
+}
+
+TEST(KillSwitchTest, BlocksSendsAndCancelsEverything) {
+    KillSwitch kill;
+    OrderManager oms(4, 16, 16, kill);
+    ParentOrder* parent = oms.new_parent(Side::Buy, 1000);
+    ParentOrder* done = oms.new_parent(Side::Sell, 100);
+    ChildOrder* a = oms.send_child(parent->id, 100, 300);
+    ChildOrder* b = oms.send_child(parent->id, 100, 300);
+    ChildOrder* c = oms.send_child(done->id, 101, 100);
+    oms.apply(report(b, ReportType::Fill, 300, 100));
+    oms.apply(report(c, ReportType::Fill, 100, 101));
+
+    kill.trigger();
+    EXPECT_EQ(oms.send_child(parent->id, 100, 100), nullptr);
+    EXPECT_EQ(oms.stats().killed_sends, 1u);
+
+    std::vector<OutboundMessage> batch;
+    EXPECT_EQ(oms.cancel_all(batch), 1u);
+    EXPECT_EQ(batch[0].child_id, a->id);
+    EXPECT_EQ(batch[0].kind, OutboundKind::Cancel);
+    EXPECT_TRUE(parent->cancel_requested);
+    EXPECT_TRUE(a->cancel_pending);
+    EXPECT_EQ(done->state, OrderState::Filled);
+
+    // Kill again before the venue answers: nothing is resent
+    EXPECT_EQ(oms.cancel_all(batch), 0u);
+    EXPECT_EQ(batch.size(), 1u);
+
+    oms.apply(report(a, ReportType::Cancel));
+    EXPECT_EQ(parent->state, OrderState::Cancelled);
+}
+
+// Every working child across many parents gets exactly one cancel (latency: bench_oms)
+TEST(KillSwitchTest, CancelAllCoversEveryWorkingChild) {
+    const size_t num_children = 10'000;
+    KillSwitch kill;
+    OrderManager oms(100, num_children, 1, kill);
+    for (size_t p = 0; p < 100; ++p) {
+        ParentOrder* parent = oms.new_parent(Side::Buy, 10'000);
+        for (size_t c = 0; c < num_children / 100; ++c) {
+            ChildOrder* child = oms.send_child(parent->id, 100 + static_cast<int64_t>(c % 8), 100);
+            oms.apply(report(child, ReportType::Ack));
+        }
+    }
+    std::vector<OutboundMessage> batch;
+    batch.reserve(num_children);
+
+    kill.trigger();
+    EXPECT_EQ(oms.cancel_all(batch), num_children);
+    EXPECT_EQ(oms.send_child(1, 100, 1), nullptr);
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include "quantile_sketch.hpp"
+
+#include <random>
+
+using namespace execution;
+
+// Uniform stream 0..n-1: quantile q should land near q * n
+TEST(QuantileSketchTest, UniformQuantiles) {
+    // Arrange
+    QuantileSketch sketch(200);
+    const int n = 1'000'000;
+
+    // Act
+    for (int i = 0; i < n; ++i) {
+        sketch.update(static_cast<double>((int64_t{i} * 7919) % n));
+    }
+
+    // Assert
+    EXPECT_EQ(sketch.count(), static_cast<uint64_t>(n));
+    EXPECT_DOUBLE_EQ(sketch.min(), 0.0);
+    EXPECT_DOUBLE_EQ(sketch.max(), n - 1.0);
+    for (double q : {0.01, 0.05, 0.5, 0.95, 0.99}) {
+        EXPECT_NEAR(sketch.quantile(q) / n, q, 0.02) << "q=" << q;
+    }
+}
+
+// Memory stays O(k) whatever the stream length
+TEST(QuantileSketchTest, BoundedMemory) {
+    QuantileSketch sketch(200);
+
+    for (int i = 0; i < 2'000'000; ++i) {
+        sketch.update(static_cast<double>(i));
+    }
+
+    EXPECT_LT(sketch.num_retained(), 1000u);
+}
+
+// Merging a sketch into itself doubles every weight: same distribution
+TEST(QuantileSketchTest, SelfMerge) {
+    QuantileSketch sketch(64, 5);
+    for (int i = 0; i < 10'000; ++i) {
+        sketch.update(static_cast<double>(i));
+    }
+
+    sketch.merge(sketch);
+
+    EXPECT_EQ(sketch.count(), 20'000u);
+    EXPECT_NEAR(sketch.rank(5000.0), 0.5, 0.03);
+    EXPECT_DOUBLE_EQ(sketch.quantile(1.0), 9999.0);
+}
+
+// Per-thread reducers merged together behave like one big sketch
+TEST(QuantileSketchTest, MergeMatchesSingleStream) {
+    // Arrange
+    std::mt19937_64 rng(42);
+    std::normal_distribution<double> slippage(0.0, 25.0);
+    QuantileSketch single(200, 1);
+    std::vector<QuantileSketch> workers;
+    for (int t = 0; t < 8; ++t) {
+        workers.emplace_back(200, t + 2);
+    }
+
+    // Act
+    for (int i = 0; i < 400'000; ++i) {
+        double x = slippage(rng);
+        single.update(x);
+        workers[i % 8].update(x);
+    }
+    QuantileSketch merged(200, 99);
+    for (const auto& w : workers) {
+        merged.merge(w);
+    }
+
+    // Assert
+    EXPECT_EQ(merged.count(), single.count());
+    for (double q : {0.01, 0.5, 0.99}) {
+        EXPECT_NEAR(merged.rank(single.quantile(q)), q, 0.02) << "q=" << q;
+    }
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "queue_position.hpp"
+
+using namespace execution;
+
+namespace {
+
+// Feed the writer's messages to the tracker, then start a new batch
+void replay(ItchWriter& writer, QueueTracker& tracker) {
+    parse_itch(writer.bytes().data(), writer.bytes().size(), tracker);
+    writer.clear();
+}
+
+} // namespace
+
+TEST(QueuePositionTest, FillsOnlyAfterQueueAheadIsConsumed) {
+    // Arrange
+    ItchWriter feed;
+    QueueTracker tracker;
+    feed.add(0, 1, 1, Side::Buy, 300, 100'0000);
+    feed.add(0, 2, 2, Side::Buy, 200, 100'0000);
+    replay(feed, tracker);
+    uint64_t id = tracker.post(Side::Buy, 100'0000, 100);
+
+    // Act
+    feed.execute(0, 3, 1, 300, 1);
+    feed.add(0, 4, 3, Side::Buy, 400, 100'0000);   // joins behind us
+    replay(feed, tracker);
+    double ahead_mid = tracker.order(id).ahead;
+    feed.execute(0, 5, 2, 200, 2);
+    feed.execute(0, 6, 3, 150, 3);                 // 150 past the queue ahead
+    replay(feed, tracker);
+
+    // Assert
+    EXPECT_DOUBLE_EQ(ahead_mid, 200.0);
+    ASSERT_EQ(tracker.fills().size(), 1u);
+    EXPECT_EQ(tracker.fills()[0].quantity, 100u);
+    EXPECT_EQ(tracker.fills()[0].timestamp, 6u);
+    EXPECT_FALSE(tracker.order(id).active);
+    EXPECT_EQ(tracker.num_active(), 0u);
+}
+
+TEST(QueuePositionTest, CancelModels) {
+    double expected[] = {600.0, 300.0, 420.0};     // Behind, Ahead, Proportional
+    CancelModel models[] = {CancelModel::Behind, CancelModel::Ahead, CancelModel::Proportional};
+
+    for (int k = 0; k < 3; ++k) {
+        ItchWriter feed;
+        QueueTracker tracker(0, models[k]);
+        feed.add(0, 1, 1, Side::Sell, 600, 101'0000);
+        replay(feed, tracker);
+        uint64_t id = tracker.post(Side::Sell, 101'0000, 100);
+        feed.add(0, 2, 2, Side::Sell, 400, 101'0000);
+        feed.cancel(0, 3, 2, 300);                  // level 1000 -> 700
+        replay(feed, tracker);
+
+        EXPECT_DOUBLE_EQ(tracker.order(id).ahead, expected[k]);
+    }
+}
+
+TEST(QueuePositionTest, TradeThroughAndCrossingAdds) {
+    ItchWriter feed;
+    QueueTracker tracker;
+    feed.add(0, 1, 1, Side::Buy, 500, 100'0000);
+    feed.add(0, 1, 2, Side::Buy, 500, 99'9900);
+    feed.add(0, 1, 3, Side::Sell, 500, 100'0200);
+    replay(feed, tracker);
+    uint64_t bid = tracker.post(Side::Buy, 100'0000, 200);
+    uint64_t offer = tracker.post(Side::Sell, 100'0100, 300);
+
+    feed.add(0, 2, 4, Side::Buy, 120, 100'0100);   // crosses our offer
+    feed.execute(0, 3, 2, 10, 1);                  // below our bid: level was swept
+    replay(feed, tracker);
+
+    EXPECT_EQ(tracker.order(offer).filled, 120u);
+    EXPECT_TRUE(tracker.order(offer).active);
+    EXPECT_EQ(tracker.order(bid).filled, 200u);
+    EXPECT_THROW(tracker.post(Side::Buy, 100'0200, 100), std::invalid_argument);  // crosses
+    EXPECT_THROW(tracker.post(Side::Sell, 100'0100, 100), std::invalid_argument); // level taken
+    EXPECT_TRUE(tracker.cancel(offer));
+    EXPECT_FALSE(tracker.cancel(offer));
+}
+
+// A replace onto a resting ref is rejected by the book, so the queue must not move either
+TEST(QueuePositionTest, RejectedReplaceKeepsQueue) {
+    ItchWriter feed;
+    QueueTracker tracker;
+    feed.add(0, 1, 1, Side::Buy, 300, 100'0000);
+    feed.add(0, 1, 2, Side::Buy, 200, 99'9900);
+    replay(feed, tracker);
+    uint64_t id = tracker.post(Side::Buy, 100'0000, 100);
+
+    feed.replace(0, 2, 1, 2, 300, 100'0100);       // new ref already resting
+    feed.replace(0, 3, 1, 1, 300, 100'0100);       // same ref
+    replay(feed, tracker);
+
+    EXPECT_DOUBLE_EQ(tracker.order(id).ahead, 300.0);
+    EXPECT_EQ(tracker.book().level(Side::Buy, 100'0000).quantity, 300u);
+    EXPECT_EQ(tracker.book().find(2)->price, 99'9900);
+    EXPECT_EQ(tracker.order(id).filled, 0u);
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include "rate_throttle.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace execution;
+
+// Explicit nanosecond clock: 1000 msgs/s = one token per 1'000'000 ticks
+TEST(RateThrottleTest, BurstThenRefill) {
+    RateThrottle throttle(1000.0, 5, 1e9);
+    const uint64_t t0 = 1'000'000'000;
+
+    EXPECT_EQ(throttle.available_at(t0), 5u);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_TRUE(throttle.try_acquire_at(t0));
+    }
+    EXPECT_FALSE(throttle.try_acquire_at(t0));
+    EXPECT_FALSE(throttle.try_acquire_at(t0 + 999'999));
+    EXPECT_TRUE(throttle.try_acquire_at(t0 + 1'000'000));
+
+    // Idle for long enough: full burst back, but never more
+    EXPECT_EQ(throttle.available_at(t0 + 60'000'000), 5u);
+    EXPECT_FALSE(throttle.try_acquire_at(t0 + 60'000'000, 6));
+    EXPECT_TRUE(throttle.try_acquire_at(t0 + 60'000'000, 3));
+    EXPECT_EQ(throttle.available_at(t0 + 60'000'000), 2u);
+
+    EXPECT_THROW(RateThrottle(0.0, 5), std::invalid_argument);
+}
+
+// Many threads at one instant: exactly burst admits, never more
+TEST(RateThrottleTest, NoOverAdmissionUnderContention) {
+    RateThrottle throttle(1000.0, 1000, 1e9);
+    std::atomic<uint64_t> admitted{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&] {
+            uint64_t mine = 0;
+            for (int i = 0; i < 10'000; ++i) {
+                mine += throttle.try_acquire_at(5'000'000'000) ? 1 : 0;
+            }
+            admitted += mine;
+        });
+    }
+    for (std::thread& t : threads) {
+        t.join();
+    }
+    EXPECT_EQ(admitted.load(), 1000u);
+}
+
+TEST(CoalescingQueueTest, MergesPerChildAndKeepsOrder) {
+    RateThrottle throttle(1.0, 1);          // one message, then nothing for a second
+    CoalescingQueue queue;
+    std::vector<OutboundMessage> sent;
+    auto send = [&](const OutboundMessage& m) { sent.push_back(m); };
+
+    EXPECT_TRUE(queue.submit(throttle, {1, OutboundKind::New, 100, 500}, send));
+    EXPECT_FALSE(queue.submit(throttle, {2, OutboundKind::New, 100, 300}, send));
+    queue.push({3, OutboundKind::Amend, 101, 200});
+    queue.push({4, OutboundKind::New, 99, 100});
+    queue.push({2, OutboundKind::Amend, 102, 250});         // folds into the pending new
+    queue.push({3, OutboundKind::Cancel});                  // replaces the pending amend
+    queue.push({3, OutboundKind::Amend, 103, 50});          // after a cancel: ignored
+    queue.push({4, OutboundKind::Cancel});                  // new + cancel: both gone
+
+    EXPECT_EQ(queue.size(), 2u);
+    EXPECT_EQ(queue.stats().coalesced, 4u);
+    EXPECT_EQ(queue.stats().dropped, 1u);
+
+    RateThrottle open(1e6, 100);
+    EXPECT_EQ(queue.drain(open, send), 2u);
+    ASSERT_EQ(sent.size(), 3u);
+    EXPECT_EQ(sent[1].child_id, 2u);
+    EXPECT_EQ(sent[1].kind, OutboundKind::New);
+    EXPECT_EQ(sent[1].price, 102);
+    EXPECT_EQ(sent[1].quantity, 250u);
+    EXPECT_EQ(sent[2].child_id, 3u);
+    EXPECT_EQ(sent[2].kind, OutboundKind::Cancel);
+    EXPECT_TRUE(queue.empty());
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include "rcu_cell.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace execution;
+
+namespace {
+
+std::atomic<int> g_alive{0};
+
+struct Limits {
+    uint32_t max_child_quantity;
+    uint32_t max_open_quantity;     // always 10x the child cap, so a torn read is detectable
+
+    explicit Limits(uint32_t child) : max_child_quantity(child), max_open_quantity(child * 10) { ++g_alive; }
+    ~Limits() { --g_alive; }
+};
+
+} // namespace
+
+TEST(RcuCellTest, ReclaimWaitsForReaders) {
+    {
+        RcuCell<Limits> cell(std::make_unique<const Limits>(100), 4);
+        auto fast = cell.register_reader();
+        auto slow = cell.register_reader();
+        const Limits* held = slow.get();
+
+        EXPECT_EQ(cell.emplace(200u), 2u);
+        fast.quiescent();
+        EXPECT_EQ(cell.reclaim(), 0u);              // slow still holds version 1
+        EXPECT_EQ(held->max_child_quantity, 100u);
+        EXPECT_EQ(fast->max_child_quantity, 200u);
+
+        slow.quiescent();
+        EXPECT_EQ(cell.reclaim(), 1u);
+        EXPECT_EQ(g_alive.load(), 1);
+
+        cell.emplace(300u);
+        slow.offline();                             // offline readers never block
+        fast.quiescent();
+        EXPECT_EQ(cell.reclaim(), 1u);
+        slow.online();                              // back online before reading again
+        EXPECT_EQ(slow->max_child_quantity, 300u);
+    }
+    EXPECT_EQ(g_alive.load(), 0);
+    EXPECT_THROW(RcuCell<Limits>(nullptr), std::invalid_argument);
+}
+
+TEST(RcuCellTest, ReaderSlotsAreRecycled) {
+    RcuCell<Limits> cell(std::make_unique<const Limits>(1), 1);
+    {
+        auto only = cell.register_reader();
+        EXPECT_THROW(cell.register_reader(), std::runtime_error);
+    }
+    auto again = cell.register_reader();
+    EXPECT_EQ(again->max_child_quantity, 1u);
+}
+
+// Readers spin on the hot path while a writer republishes; no torn or freed reads, no leaks
+TEST(RcuCellTest, ConcurrentReadersAndWriter) {
+    {
+        RcuCell<Limits> cell(std::make_unique<const Limits>(1), 8);
+        std::atomic<bool> stop{false};
+        std::atomic<uint64_t> bad{0};
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 4; ++t) {
+            readers.emplace_back([&] {
+                auto reader = cell.register_reader();
+                uint32_t last = 0;
+                while (!stop.load(std::memory_order_relaxed)) {
+                    for (int i = 0; i < 64; ++i) {
+                        const Limits* limits = reader.get();
+                        bool torn = limits->max_open_quantity != limits->max_child_quantity * 10;
+                        bool stale = limits->max_child_quantity < last;
+                        bad += (torn || stale) ? 1 : 0;
+                        last = limits->max_child_quantity;
+                    }
+                    reader.quiescent();
+                }
+            });
+        }
+        for (uint32_t v = 2; v <= 5000; ++v) {
+            cell.emplace(v);
+        }
+        stop = true;
+        for (std::thread& t : readers) {
+            t.join();
+        }
+        cell.synchronize();
+        EXPECT_EQ(cell.pending(), 0u);
+        EXPECT_EQ(cell.get()->max_child_quantity, 5000u);
+        EXPECT_EQ(bad.load(), 0u);
+        EXPECT_EQ(g_alive.load(), 1);
+    }
+    EXPECT_EQ(g_alive.load(), 0);
+}
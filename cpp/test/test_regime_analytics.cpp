@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include "regime_analytics.hpp"
+#include "kernels.hpp"
+
+#include <cmath>
+
+using namespace execution;
+
+namespace {
+
+// Random-walk-ish prices with a calm half and a volatile half
+void make_history(std::vector<double>& prices, std::vector<double>& volumes, size_t n) {
+    prices.resize(n);
+    volumes.resize(n);
+    double p = 100.0;
+    for (size_t i = 0; i < n; ++i) {
+        double amp = i < n / 2 ? 0.002 : 0.02;
+        p *= 1.0 + amp * std::sin(0.7 * i) * std::cos(1.3 * i);
+        prices[i] = p;
+        volumes[i] = 1e6 * (1.5 + std::sin(0.05 * i));
+    }
+}
+
+} // namespace
+
+TEST(RegimeAnalyticsTest, RollingVolatilityWarmup) {
+    std::vector<double> prices(50, 100.0);
+
+    auto vol = rolling_volatility(prices, 20);
+
+    EXPECT_TRUE(std::isnan(vol[19]));
+    EXPECT_DOUBLE_EQ(vol[20], 0.0);
+    EXPECT_DOUBLE_EQ(vol[49], 0.0);
+}
+
+// A bad price blanks only the windows that hold it; later values recover
+TEST(RegimeAnalyticsTest, RollingVolatilitySkipsBadPrices) {
+    std::vector<double> prices, volumes;
+    make_history(prices, volumes, 200);
+    std::vector<double> clean = rolling_volatility(prices, 20);
+    prices[100] = 0.0;
+    prices[150] = NAN;
+
+    auto vol = rolling_volatility(prices, 20);
+
+    EXPECT_NEAR(vol[99], clean[99], 1e-12);
+    EXPECT_TRUE(std::isnan(vol[100]));
+    EXPECT_TRUE(std::isnan(vol[120]));      // window still reaches the 0 -> price return
+    EXPECT_TRUE(std::isfinite(vol[121]));
+    EXPECT_NEAR(vol[140], clean[140], 1e-9);
+    EXPECT_TRUE(std::isnan(vol[170]));
+    EXPECT_NEAR(vol[199], clean[199], 1e-9);
+}
+
+// Every start index lands in exactly one bucket or is skipped
+TEST(RegimeAnalyticsTest, BucketsCoverAllStarts) {
+    // Arrange
+    std::vector<double> prices, volumes;
+    make_history(prices, volumes, 3000);
+    Order order(10'000.0, "buy", 10);
+    RegimeConfig config;
+    config.num_threads = 4;
+
+    // Act
+    RegimeReport report = regime_backtest(prices, volumes, order, config);
+
+    // Assert
+    uint64_t total = report.num_skipped;
+    for (const auto& b : report.buckets) {
+        total += b.count;
+    }
+    ASSERT_EQ(report.buckets.size(), 9u);
+    EXPECT_EQ(total, prices.size() - order.num_slices + 1);
+    EXPECT_EQ(report.vol_edges.size(), 2u);
+}
+
+// Per-thread reducers give the same aggregates as a single pass
+TEST(RegimeAnalyticsTest, ThreadCountInvariant) {
+    std::vector<double> prices, volumes;
+    make_history(prices, volumes, 3000);
+    Order order(10'000.0, "buy", 20);
+    RegimeConfig single;
+    single.num_threads = 1;
+    RegimeConfig multi;
+    multi.num_threads = 8;
+
+    RegimeReport a = regime_backtest(prices, volumes, order, single);
+    RegimeReport b = regime_backtest(prices, volumes, order, multi);
+
+    for (size_t i = 0; i < a.buckets.size(); ++i) {
+        EXPECT_EQ(a.buckets[i].count, b.buckets[i].count);
+        EXPECT_NEAR(a.buckets[i].twap_mean_bps, b.buckets[i].twap_mean_bps, 1e-9);
+        EXPECT_NEAR(a.buckets[i].vwap_mean_bps, b.buckets[i].vwap_mean_bps, 1e-9);
+    }
+}
+
+// Fixed-N window kernels (dispatched for 5 slices) give the run-time result bit for bit
+TEST(RegimeAnalyticsTest, FixedSliceKernelsMatchRunTime) {
+    std::vector<double> prices, volumes;
+    make_history(prices, volumes, 200);
+    for (size_t i = 40; i < 50; ++i) {
+        volumes[i] = 0.0;               // windows without volume take the TWAP fallback
+    }
+    volumes[60] = std::nan("");
+
+    for (size_t s = 0; s + 5 <= prices.size(); ++s) {
+        const double* p = prices.data() + s;
+        const double* v = volumes.data() + s;
+        EXPECT_EQ(twap_avg_price<5>(p, 5), twap_avg_price(p, 5));
+        EXPECT_EQ(vwap_avg_price<5>(p, v, 5), vwap_avg_price(p, v, 5));
+    }
+    EXPECT_EQ(dispatch_slice_count(5, [](auto fixed) { return decltype(fixed)::value; }), 5u);
+    EXPECT_EQ(dispatch_slice_count(7, [](auto fixed) { return decltype(fixed)::value; }), 0u);
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include "session_calendar.hpp"
+
+#include <numeric>
+
+using namespace execution;
+
+TEST(SessionCalendarTest, WeekdaysHolidaysAndHalfDays) {
+    // Thanksgiving week 2024: Thu 28 closed, Fri 29 half-day
+    SessionCalendar cal = SessionCalendar::weekdays(20241125, 20241203, {20241128}, {20241129});
+
+    EXPECT_EQ(day_of_week(20241125), 0);        // Monday
+    EXPECT_EQ(day_of_week(20000101), 5);        // Saturday
+    ASSERT_EQ(cal.size(), 6u);                  // Mon-Wed, Fri, Mon-Tue
+    EXPECT_EQ(cal[3].date, 20241129);
+    EXPECT_EQ(cal[3].minutes(), 210u);
+    EXPECT_EQ(cal.index_of(20241128), 3u);      // holiday rolls to the next session
+    EXPECT_EQ(cal.index_of(20241130), 4u);
+    EXPECT_EQ(cal.index_of(20250101), cal.size());
+    EXPECT_EQ(cal.minutes_between(0, 6), 5u * 390 + 210);
+
+    EXPECT_THROW(SessionCalendar({{20240102, 570, 960}, {20240102, 570, 960}}), std::invalid_argument);
+}
+
+TEST(SessionCalendarTest, SchedulesRespectSessionsAndBudgets) {
+    SessionCalendar cal = SessionCalendar::weekdays(20241125, 20241203, {20241128}, {20241129});
+    std::vector<MultiDayOrder> orders = {
+        {20241127, 2, 6000.0},                  // Wed full day + Fri half-day
+        {20241126, 1, 1000.0, 900},             // starts 15:00: two 30-minute slices
+        {20241126, 2, 1000.0, 1000},            // after the close: Wed and Fri
+        {20241202, 5, 500.0},                   // runs off the calendar: 2 sessions
+    };
+    ScheduleConfig config;
+    config.num_threads = 2;
+    Schedule sched = build_schedules(cal, orders, config);
+
+    ASSERT_EQ(sched.num_orders(), 4u);
+    EXPECT_EQ(sched.order_offsets[1], 13u + 7u);
+    EXPECT_EQ(sched.order_offsets[2] - sched.order_offsets[1], 2u);
+    EXPECT_EQ(sched.session[sched.order_offsets[2]], 2u);
+    EXPECT_EQ(sched.order_offsets[4] - sched.order_offsets[3], 26u);
+
+    // By-minutes budget: 390 / 600 of the order on the full day
+    double wed = std::accumulate(sched.quantity.begin(), sched.quantity.begin() + 13, 0.0);
+    double total = std::accumulate(sched.quantity.begin(), sched.quantity.begin() + 20, 0.0);
+    EXPECT_NEAR(wed, 6000.0 * 390 / 600, 1e-9);
+    EXPECT_NEAR(total, 6000.0, 1e-9);
+    EXPECT_EQ(sched.minute[13], 570);           // Friday restarts at the open
+    EXPECT_EQ(sched.minute[sched.order_offsets[1] + 1], 930);
+
+    config.budget = SessionBudget::Equal;
+    Schedule equal = build_schedules(cal, orders, config);
+    EXPECT_NEAR(std::accumulate(equal.quantity.begin(), equal.quantity.begin() + 13, 0.0), 3000.0, 1e-9);
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include "slice_sweep.hpp"
+#include "kernels.hpp"
+#include "moments.hpp"
+#include "synthetic_history.hpp"
+
+#include <cmath>
+#include <random>
+
+using namespace execution;
+
+namespace {
+
+// Runs of zero-volume days, plus bad volumes the kernels must tolerate
+void make_history(size_t n, std::vector<double>& prices, std::vector<double>& volumes) {
+    random_walk(n, 3, 97, 7, prices, volumes);
+    volumes[11] = std::nan("");
+}
+
+} // namespace
+
+TEST(SliceSweepTest, MatchesWindowKernels) {
+    std::vector<double> prices, volumes;
+    make_history(5000, prices, volumes);
+    SweepConfig config;
+    config.slice_counts = {1, 5, 7, 50};
+    config.direction = "sell";
+    config.block_size = 64;                     // many tiles, windows straddling tile edges
+    config.num_threads = 3;
+    SweepGrid grid = sweep_slices(prices, volumes, config);
+
+    ASSERT_EQ(grid.num_starts, 5000u);
+    for (size_t ki = 0; ki < config.slice_counts.size(); ++ki) {
+        size_t k = config.slice_counts[ki];
+        for (size_t s = 0; s < grid.num_starts; ++s) {
+            if (s + k > prices.size()) {
+                EXPECT_TRUE(std::isnan(grid.twap(ki, s)));
+                continue;
+            }
+            double twap = slippage_bps(twap_avg_price(&prices[s], k), prices[s], -1.0);
+            double vwap = slippage_bps(vwap_avg_price(&prices[s], &volumes[s], k), prices[s], -1.0);
+            ASSERT_NEAR(grid.twap(ki, s), twap, 1e-8) << "k=" << k << " s=" << s;
+            ASSERT_NEAR(grid.vwap(ki, s), vwap, 1e-8) << "k=" << k << " s=" << s;
+        }
+    }
+}
+
+TEST(SliceSweepTest, TilingDoesNotChangeResults) {
+    std::vector<double> prices, volumes;
+    make_history(20'000, prices, volumes);
+    SweepConfig tiled;
+    tiled.slice_counts = {5, 10, 20};
+    SweepConfig naive = tiled;
+    naive.block_size = 0;
+    naive.num_threads = 1;
+
+    std::vector<SliceStats> a = sweep_slice_stats(prices, volumes, tiled);
+    std::vector<SliceStats> b = sweep_slice_stats(prices, volumes, naive);
+    SweepGrid grid = sweep_slices(prices, volumes, tiled);
+    ASSERT_EQ(a.size(), 3u);
+    for (size_t ki = 0; ki < a.size(); ++ki) {
+        EXPECT_EQ(a[ki].count, prices.size() - tiled.slice_counts[ki] + 1);
+        EXPECT_EQ(a[ki].count, b[ki].count);
+        EXPECT_NEAR(a[ki].twap_mean_bps, b[ki].twap_mean_bps, 1e-6);
+        EXPECT_NEAR(a[ki].vwap_std_bps, b[ki].vwap_std_bps, 1e-6);
+        double sum = 0.0;
+        for (size_t s = 0; s < a[ki].count; ++s) {
+            sum += grid.twap(ki, s);
+        }
+        EXPECT_NEAR(a[ki].twap_mean_bps, sum / a[ki].count, 1e-6);
+    }
+    EXPECT_THROW(sweep_slices(prices, std::vector<double>(3), tiled), std::invalid_argument);
+
+    // Untiled worker ranges span many re-seeds; grid matches the kernels there too
+    SweepGrid streamed = sweep_slices(prices, volumes, naive);
+    for (size_t s = 0; s + 20 <= prices.size(); s += 997) {
+        double vwap = slippage_bps(vwap_avg_price(&prices[s], &volumes[s], 20), prices[s]);
+        ASSERT_NEAR(streamed.vwap(2, s), vwap, 1e-8) << "s=" << s;
+    }
+
+    // One NaN price would poison every later running sum
+    prices[123] = std::nan("");
+    EXPECT_THROW(sweep_slices(prices, volumes, tiled), std::invalid_argument);
+    EXPECT_THROW(sweep_slice_stats(prices, volumes, naive), std::invalid_argument);
+}
+
+// sum(x^2) - n mean^2 cancels to noise at this offset; centered partials do not
+TEST(RunningMomentsTest, StableAtLargeOffset) {
+    std::vector<double> x;
+    for (int i = 0; i < 1000; ++i) {
+        x.push_back(1e9 + (i % 2 == 0 ? -1.0 : 1.0));
+    }
+    RunningMoments one_by_one, batched, left, right;
+    for (double v : x) {
+        one_by_one.add(v);
+    }
+    batched.add_batch(x.data(), 300);
+    batched.add_batch(x.data() + 300, 700);
+    left.add_batch(x.data(), 1);
+    right.add_batch(x.data() + 1, 999);
+    left.merge(right);
+
+    double expected = std::sqrt(1000.0 / 999.0);
+    EXPECT_NEAR(one_by_one.sample_std(), expected, 1e-6);
+    EXPECT_NEAR(batched.sample_std(), expected, 1e-6);
+    EXPECT_NEAR(left.sample_std(), expected, 1e-6);
+    EXPECT_DOUBLE_EQ(batched.mean, 1e9);
+    EXPECT_EQ(RunningMoments{}.sample_std(), 0.0);
+}
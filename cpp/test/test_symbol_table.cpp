@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include "symbol_table.hpp"
+
+#include <random>
+#include <set>
+
+using namespace execution;
+
+TEST(SymbolTableTest, DenseIdsInOrderOfFirstAppearance) {
+    SymbolTable table;
+    EXPECT_EQ(table.intern("SPY"), 0u);
+    EXPECT_EQ(table.intern("AAPL"), 1u);
+    EXPECT_EQ(table.intern("SPY"), 0u);
+    EXPECT_EQ(table.find("AAPL"), 1u);          // before build: load-time index
+    EXPECT_FALSE(table.built());
+
+    table.build();
+    EXPECT_EQ(table.find("SPY"), 0u);
+    EXPECT_EQ(table.find("AAPL"), 1u);
+    EXPECT_EQ(table.find("MSFT"), SymbolTable::NOT_FOUND);
+    EXPECT_EQ(table.find(""), SymbolTable::NOT_FOUND);
+    EXPECT_EQ(table.name(1), "AAPL");
+
+    const char stock[8] = {'A', 'A', 'P', 'L', ' ', ' ', ' ', ' '};
+    EXPECT_EQ(table.find_itch(stock), 1u);
+
+    SymbolTable empty(std::vector<std::string>{});
+    EXPECT_EQ(empty.find("SPY"), SymbolTable::NOT_FOUND);
+}
+
+// Every key of a realistic universe resolves to its own id; near misses do not
+TEST(SymbolTableTest, PerfectHashOverLargeUniverse) {
+    std::mt19937_64 rng(11);
+    std::set<std::string> unique;
+    while (unique.size() < 10'000) {
+        std::string s(1 + rng() % 8, 'A');
+        for (char& c : s) {
+            c = static_cast<char>('A' + rng() % 26);
+        }
+        unique.insert(s);
+    }
+    std::vector<std::string> tickers(unique.begin(), unique.end());
+    SymbolTable table(tickers);
+
+    ASSERT_EQ(table.size(), tickers.size());
+    EXPECT_LE(table.num_buckets(), tickers.size() / 4 + 1);
+    for (uint32_t id = 0; id < tickers.size(); ++id) {
+        ASSERT_EQ(table.find(tickers[id]), id);
+    }
+    size_t false_hits = 0;
+    for (const std::string& t : tickers) {
+        std::string miss = t + "Z";
+        false_hits += table.find(miss) != SymbolTable::NOT_FOUND && !unique.count(miss);
+    }
+    EXPECT_EQ(false_hits, 0u);
+}
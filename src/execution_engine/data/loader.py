@@ -1,15 +1,61 @@
 from pathlib import Path
 
+import numpy as np
 import pandas as pd
 
+try:
+    from src.execution_engine import _execution_cpp as _cpp
+except ImportError:
+    _cpp = None
+
 # Constants
 DATA_PATH = Path(__file__).parent.parent.parent.parent / "data" / "SP500.csv"
 
 
-def load_data(filepath: Path) -> pd.DataFrame:
+def load_data(filepath: Path, native: bool = False) -> pd.DataFrame:
+    """Load OHLCV bars and clean them once, so strategies can skip NaN checks.
+
+    Missing, negative or infinite volumes become 0, missing prices are
+    forward-filled (leading rows with no price are dropped) and dates must be
+    strictly increasing. HasVolume marks the bars that traded.
+
+    native=True parses and cleans in the C++ loader (load_market_data), which
+    applies the same policy; it needs the C++ module to be built.
+    """
+    if native:
+        if _cpp is None:
+            raise RuntimeError("native loading needs the C++ module (make build-cpp)")
+        return _load_native(filepath)
+
     df = pd.read_csv(filepath, parse_dates=["Date"])
 
-    if df["Volume"].isna().any():
-        df["Volume"] = df["Volume"].fillna()
+    volume = df["Volume"]
+    df["Volume"] = volume.where(np.isfinite(volume) & (volume >= 0), 0.0)
 
+    prices = ["Open", "High", "Low", "Close"]
+    df[prices] = df[prices].ffill()
+    df = df.dropna(subset=prices).reset_index(drop=True)
+
+    if not df["Date"].is_monotonic_increasing or not df["Date"].is_unique:
+        raise ValueError("dates must be strictly increasing")
+
+    df["HasVolume"] = df["Volume"] > 0
     return df
+
+
+def _load_native(filepath: Path) -> pd.DataFrame:
+    # Raises ValueError on out-of-order dates, like the pandas path
+    data = _cpp.load_market_data(str(filepath))
+    bars = data.bars
+    dates = pd.Series(bars.timestamps, dtype="int64").astype(str)
+    return pd.DataFrame(
+        {
+            "Date": pd.to_datetime(dates, format="%Y%m%d"),
+            "Close": bars.close,
+            "High": bars.high,
+            "Low": bars.low,
+            "Open": bars.open,
+            "Volume": bars.volume,
+            "HasVolume": data.has_volume.to_list(),
+        }
+    )
@@ -10,6 +10,8 @@ def execute_vwap(df: pd.DataFrame, order: Order, start_idx: int) -> ExecutionRes
     """Execute order using VWAP: slices proportional to volume.
     VWAP allocates more shares to days with higher volume,
     minimizing market impact.
+
+    Expects volumes cleaned as by load_data (no NaN); they are not re-checked here.
     """
     # Get volume data for execution window
     end_idx = start_idx + order.num_slices
@@ -18,11 +20,6 @@ def execute_vwap(df: pd.DataFrame, order: Order, start_idx: int) -> ExecutionRes
 
     window_df = df.iloc[start_idx:end_idx].copy()
 
-    # Check if NaN
-    if window_df["Volume"].isna().any():
-        logger.warning(f"Found {window_df['Volume'].isna().sum()} NaN volumes. Filling with 0.")
-        window_df["Volume"] = window_df["Volume"].fillna(0)
-
     # Calculate volume proportions
     total_volume = window_df["Volume"].sum()
     if total_volume == 0:
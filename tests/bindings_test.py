@@ -2,6 +2,8 @@
 
 import pytest
 
+from execution_engine import DATA_PATH, load_data
+
 try:
     import src.execution_engine._execution_cpp as cpp
 
@@ -55,3 +57,411 @@ class TestCppExecutionEngine:
 
         assert hasattr(result, "slices")
         assert len(result.slices) == 5
+
+
+@pytest.mark.skipif(not CPP_AVAILABLE, reason="C++ module not available")
+class TestCppQuantileSketch:
+    def test_median(self):
+        sketch = cpp.QuantileSketch()
+        sketch.update_many([float(i) for i in range(10_001)])
+
+        assert sketch.count == 10_001
+        assert abs(sketch.quantile(0.5) - 5_000) < 200
+
+    def test_merge(self):
+        a = cpp.QuantileSketch(seed=1)
+        b = cpp.QuantileSketch(seed=2)
+        a.update_many([float(i) for i in range(1_000)])
+        b.update_many([float(i) for i in range(1_000, 2_000)])
+
+        a.merge(b)
+
+        assert a.count == 2_000
+        assert a.min == 0.0
+        assert a.max == 1_999.0
+
+
+@pytest.mark.skipif(not CPP_AVAILABLE, reason="C++ module not available")
+class TestCppRegimeBacktest:
+    def test_buckets_cover_history(self):
+        df = load_data(DATA_PATH)
+        prices = df["Close"].tolist()
+        volumes = df["Volume"].tolist()
+        order = cpp.Order(10_000, "buy", 10)
+
+        report = cpp.regime_backtest(prices, volumes, order)
+
+        counted = sum(b.count for b in report.buckets) + report.num_skipped
+        assert len(report.buckets) == 9
+        assert counted == len(prices) - 10 + 1
+
+
+@pytest.mark.skipif(not CPP_AVAILABLE, reason="C++ module not available")
+class TestCppCostGradient:
+    def test_gradient(self):
+        prices = [100.0 + 0.1 * i for i in range(200)]
+        volumes = [1e6] * 200
+        order = cpp.Order(10_000, "buy", 10)
+
+        grad = cpp.history_cost_gradient(prices, volumes, order, 20.0, 1e-3)
+
+        assert grad.count == 191
+        assert grad.d_eta > 0
+
+
+@pytest.mark.skipif(not CPP_AVAILABLE, reason="C++ module not available")
+class TestCppDPSolver:
+    def test_schedule_sums_to_order(self):
+        config = cpp.DPConfig()
+        config.num_steps = 50
+        config.num_lots = 1_000
+        model = cpp.DPCostModel()
+
+        schedule = cpp.solve_optimal_schedule(config, model)
+
+        assert len(schedule.trades) == 50
+        assert sum(schedule.trades) == pytest.approx(1_000 * config.lot_size)
+
+
+@pytest.mark.skipif(not CPP_AVAILABLE, reason="C++ module not available")
+class TestCppExecutionEnv:
+    def test_reset_and_step(self):
+        import numpy as np
+
+        config = cpp.EnvConfig()
+        config.num_envs = 128
+        config.horizon = 5
+        env = cpp.ExecutionEnv([100.0] * 200, [1e6] * 200, config)
+
+        obs = env.reset()
+        obs, rewards, dones = env.step(np.full(128, 0.2, dtype=np.float32))
+
+        assert obs.shape == (128, cpp.ExecutionEnv.obs_dim)
+        assert rewards.shape == (128,)
+        assert not dones.any()
+        assert np.allclose(obs[:, 0], 0.8)
+
+
+@pytest.mark.skipif(not CPP_AVAILABLE, reason="C++ module not available")
+class TestCppMLPModel:
+    def test_load_and_predict(self, tmp_path):
+        import numpy as np
+
+        path = tmp_path / "model.txt"
+        path.write_text("mlp\ndense 4 1 sigmoid\n0 0 0 0\n0\n")
+        model = cpp.MLPModel.load(str(path))
+
+        single = model.predict([0.1, 0.2, 0.3, 0.4])
+        batch = model.predict_batch(np.zeros((10, 4), dtype=np.float32))
+
+        assert single[0] == pytest.approx(0.5)
+        assert batch.shape == (10, 1)
+        assert np.allclose(batch, 0.5)
+
+
+@pytest.mark.skipif(not CPP_AVAILABLE, reason="C++ module not available")
+class TestCppFeatureMatrix:
+    def test_build_from_history(self):
+        df = load_data(DATA_PATH)
+        md = cpp.MarketData()
+        md.open = df["Open"].tolist()
+        md.high = df["High"].tolist()
+        md.low = df["Low"].tolist()
+        md.close = df["Close"].tolist()
+        md.volume = df["Volume"].tolist()
+
+        builder = cpp.FeatureMatrixBuilder()
+        builder.add(cpp.FeatureKind.Return, 1).add(cpp.FeatureKind.RollingVol, 20)
+        matrix = builder.build([md], cpp.MatrixLayout.ColumnMajor)
+
+        assert matrix.shape == (len(df), 2)
+        assert matrix.flags["F_CONTIGUOUS"]
+        assert builder.names() == ["return_1", "rolling_vol_20"]
+
+
+@pytest.mark.skipif(not CPP_AVAILABLE, reason="C++ module not available")
+class TestCppImpactCalibration:
+    def test_linear_fit(self):
+        fills = cpp.FillRecords()
+        fills.size = [1_000.0 * (i + 1) for i in range(100)]
+        fills.adv = [1e6] * 100
+        fills.volatility = [0.02] * 100
+        fills.cost_bps = [1.0 + 0.5 * 200.0 * s / 1e6 for s in fills.size]
+
+        fit = cpp.calibrate_impact(fills, cpp.ImpactModelKind.Linear)
+
+        assert fit.coefficient == pytest.approx(0.5)
+        assert fit.intercept_bps == pytest.approx(1.0)
+
+
+@pytest.mark.skipif(not CPP_AVAILABLE, reason="C++ module not available")
+class TestCppIntradayGenerator:
+    def test_bars_match_daily(self):
+        daily = cpp.MarketData()
+        daily.timestamps = [20200102]
+        daily.open = [100.0]
+        daily.high = [102.0]
+        daily.low = [99.0]
+        daily.close = [101.0]
+        daily.volume = [1e6]
+
+        bars = cpp.generate_intraday_day(daily, 0)
+
+        assert len(bars) == 390
+        assert bars.open[0] == 100.0 and bars.close[-1] == 101.0
+        assert max(bars.high) == 102.0 and min(bars.low) == 99.0
+        assert sum(bars.volume) == pytest.approx(1e6)
+        assert len(cpp.intraday_twap_slippage(daily, 10)) == 1
+
+
+@pytest.mark.skipif(not CPP_AVAILABLE, reason="C++ module not available")
+class TestCppBarAggregator:
+    def test_volume_bars(self):
+        ticks = cpp.TickData()
+        ticks.timestamps = list(range(10))
+        ticks.price = [100.0 + i for i in range(10)]
+        ticks.size = [50.0] * 10
+
+        time_bars, volume_bars = cpp.aggregate_bars(
+            ticks, [cpp.BarSpec(cpp.BarKind.Time, 5), cpp.BarSpec(cpp.BarKind.Volume, 100.0)]
+        )
+
+        assert len(time_bars) == 2
+        assert len(volume_bars) == 5
+        assert volume_bars.open[1] == 102.0 and volume_bars.close[1] == 103.0
+
+
+@pytest.mark.skipif(not CPP_AVAILABLE, reason="C++ module not available")
+class TestCppItchReplay:
+    def test_sample_file(self, tmp_path):
+        writer = cpp.ItchWriter()
+        writer.add(1, 0, 1, cpp.Side.Buy, 500, 1_000_000, "SPY")
+        writer.add(1, 1, 2, cpp.Side.Sell, 300, 1_000_100, "SPY")
+        writer.execute(1, 2, 1, 200, 1)
+        writer.replace(1, 3, 2, 3, 300, 1_000_200)
+        path = str(tmp_path / "sample.itch")
+        writer.save(path)
+
+        replay = cpp.ItchBookReplay()
+        stats = replay.parse_file(path)
+        book = replay.book(1)
+
+        assert stats.messages == 4 and not stats.truncated
+        assert book.best_bid == 1_000_000 and book.best_ask == 1_000_200
+        assert book.level(cpp.Side.Buy, 1_000_000).quantity == 300
+
+
+@pytest.mark.skipif(not CPP_AVAILABLE, reason="C++ module not available")
+class TestCppQueuePosition:
+    def test_fill_after_queue_ahead(self, tmp_path):
+        before, after = cpp.ItchWriter(), cpp.ItchWriter()
+        before.add(0, 1, 1, cpp.Side.Buy, 300, 1_000_000)
+        after.execute(0, 2, 1, 300, 1)
+        after.add(0, 3, 2, cpp.Side.Sell, 50, 1_000_000)   # crosses our bid
+        before.save(str(tmp_path / "before.itch"))
+        after.save(str(tmp_path / "after.itch"))
+
+        tracker = cpp.QueueTracker()
+        tracker.parse_file(str(tmp_path / "before.itch"))
+        order_id = tracker.post(cpp.Side.Buy, 1_000_000, 100)
+        assert tracker.order(order_id).ahead == 300
+        tracker.parse_file(str(tmp_path / "after.itch"))
+
+        assert tracker.order(order_id).filled == 50
+        assert [f.quantity for f in tracker.fills] == [50]
+
+
+@pytest.mark.skipif(not CPP_AVAILABLE, reason="C++ module not available")
+class TestCppLimitStrategy:
+    def test_sweep(self, tmp_path):
+        writer = cpp.ItchWriter()
+        writer.add(0, 0, 1, cpp.Side.Sell, 1000, 1_000_200)
+        writer.add(0, 0, 2, cpp.Side.Buy, 100, 1_000_000)
+        for i in range(1, 101):
+            writer.add(0, i * 1000, 2 + i, cpp.Side.Buy, 100, 1_000_000)
+            writer.execute(0, i * 1000, 1 + i, 100, i)
+        path = str(tmp_path / "tape.itch")
+        writer.save(path)
+        tape = cpp.BookTape()
+        tape.parse_file(path)
+
+        config = cpp.PlacementConfig()
+        config.quantity = 500
+        config.start_time = 1000
+        config.end_time = 101_000
+        config.num_slices = 5
+        results = cpp.sweep_limit_strategy(tape, config, [cpp.PlacementParams(1.0), cpp.PlacementParams(0.0)])
+
+        assert [r.filled for r in results] == [500, 500]
+        assert results[0].avg_price == 1_000_000
+        assert results[1].avg_price == 1_000_200
+
+
+@pytest.mark.skipif(not CPP_AVAILABLE, reason="C++ module not available")
+class TestCppOrderManager:
+    def test_reports_drive_parent(self):
+        oms = cpp.OrderManager(4, 16, 16)
+        parent = oms.new_parent(cpp.Order(500, "buy", 2))
+        a = oms.send_child(parent.id, 100, 300)
+        b = oms.send_child(parent.id, 101, 200)
+        assert oms.send_child(parent.id, 101, 1) is None
+
+        assert oms.apply(cpp.ExecutionReport(a.id, cpp.ReportType.Ack))
+        assert oms.apply(cpp.ExecutionReport(a.id, cpp.ReportType.Fill, 300, 100))
+        assert oms.apply(cpp.ExecutionReport(b.id, cpp.ReportType.Reject))
+        assert not oms.apply(cpp.ExecutionReport(a.id, cpp.ReportType.Cancel))
+
+        # Snapshots: re-query by id
+        assert a.state == cpp.OrderState.New
+        assert oms.find_child(a.id).state == cpp.OrderState.Filled
+        parent_now = oms.find_parent(parent.id)
+        assert parent_now.state == cpp.OrderState.PartiallyFilled
+        assert oms.remaining(parent.id) == 200 and parent_now.unallocated == 200
+
+        assert oms.cancel_parent(parent.id) == 0 and oms.release_parent(parent.id)
+        assert oms.find_parent(parent.id) is None and oms.find_child(a.id) is None
+
+    def test_kill_switch_and_cancel_all(self):
+        kill = cpp.KillSwitch.global_switch()
+        oms = cpp.OrderManager(4, 16, 16)
+        parent = oms.new_parent(cpp.Side.Buy, 400)
+        children = [oms.send_child(parent.id, 100, 100) for _ in range(3)]
+        kill.trigger()
+        try:
+            assert oms.send_child(parent.id, 100, 100) is None
+            batch = oms.cancel_all()
+        finally:
+            kill.reset()
+        assert sorted(m.child_id for m in batch) == sorted(c.id for c in children)
+        assert all(m.kind == cpp.OutboundKind.Cancel for m in batch)
+
+
+@pytest.mark.skipif(not CPP_AVAILABLE, reason="C++ module not available")
+class TestCppRateThrottle:
+    def test_burst_and_coalescing(self):
+        throttle = cpp.RateThrottle(1.0, 2)
+        assert throttle.try_acquire() and throttle.try_acquire()
+        assert not throttle.try_acquire()
+
+        queue = cpp.CoalescingQueue()
+        sent = []
+        assert not queue.submit(throttle, cpp.OutboundMessage(1, cpp.OutboundKind.New, 100, 500), sent.append)
+        queue.push(cpp.OutboundMessage(1, cpp.OutboundKind.Amend, 101, 400))
+        queue.push(cpp.OutboundMessage(2, cpp.OutboundKind.New, 99, 100))
+        queue.push(cpp.OutboundMessage(2, cpp.OutboundKind.Cancel))
+        assert len(queue) == 1
+
+        assert queue.drain(cpp.RateThrottle(1e6, 10), sent.append) == 1
+        assert [(m.child_id, m.price, m.quantity) for m in sent] == [(1, 101, 400)]
+
+
+@pytest.mark.skipif(not CPP_AVAILABLE, reason="C++ module not available")
+class TestCppSymbolTable:
+    def test_dense_ids(self):
+        table = cpp.SymbolTable(["SPY", "AAPL", "SPY", "MSFT"])
+        assert len(table) == 3
+        assert [table.find(s) for s in ["SPY", "AAPL", "MSFT"]] == [0, 1, 2]
+        assert table.find("QQQ") is None
+        assert table.name(2) == "MSFT"
+
+
+@pytest.mark.skipif(not CPP_AVAILABLE, reason="C++ module not available")
+class TestCppSessionCalendar:
+    def test_multi_day_schedule(self):
+        cal = cpp.SessionCalendar.weekdays(20241125, 20241203, [20241128], [20241129])
+        assert len(cal) == 6 and cal[3].minutes == 210
+
+        orders = [cpp.MultiDayOrder(20241127, 2, 6000.0), cpp.MultiDayOrder(20241202, 1, 390.0)]
+        sched = cpp.build_schedules(cal, orders)
+
+        assert sched.order_offsets == [0, 20, 33]
+        assert sum(sched.quantity[:20]) == pytest.approx(6000.0)
+        assert sched.minute[13] == 570
+
+
+@pytest.mark.skipif(not CPP_AVAILABLE, reason="C++ module not available")
+class TestCppSliceSweep:
+    def test_grid_matches_direct_average(self):
+        prices = [100.0 + 0.1 * ((i * 7) % 13) for i in range(300)]
+        volumes = [1000.0 + (i * 37) % 500 for i in range(300)]
+        config = cpp.SweepConfig()
+        config.slice_counts = [5, 20]
+        config.block_size = 64
+
+        grid = cpp.sweep_slices(prices, volumes, config)
+        assert grid.twap_bps.shape == (2, 296)
+        assert grid.twap_bps[1, -1] != grid.twap_bps[1, -1]  # NaN past the data
+        window = range(10, 30)
+        vwap = sum(prices[i] * volumes[i] for i in window) / sum(volumes[i] for i in window)
+        assert grid.vwap_bps[1, 10] == pytest.approx((vwap / prices[10] - 1.0) * 1e4, abs=1e-9)
+
+        stats = cpp.sweep_slice_stats(prices, volumes, config)
+        assert [s.count for s in stats] == [296, 281]
+        assert stats[1].twap_mean_bps == pytest.approx(sum(grid.twap_bps[1, :281]) / 281, abs=1e-9)
+
+
+@pytest.mark.skipif(not CPP_AVAILABLE, reason="C++ module not available")
+class TestCppLaneBatch:
+    def test_lane_widths_agree(self):
+        prices = [100.0 + 0.1 * ((i * 7) % 13) for i in range(200)]
+        volumes = [1000.0 + (i * 37) % 500 for i in range(200)]
+        starts = [(i * 31) % 190 for i in range(37)]
+
+        results = [cpp.batch_slippage(prices, volumes, starts, 10, "sell", lanes) for lanes in (4, 8, 16)]
+        for out in results[1:]:
+            assert out.vwap_bps == pytest.approx(results[0].vwap_bps, abs=1e-9)
+
+        s = starts[5]
+        twap = sum(prices[s : s + 10]) / 10
+        assert results[0].twap_bps[5] == pytest.approx(-(twap / prices[s] - 1.0) * 1e4, abs=1e-9)
+
+        with pytest.raises(ValueError):
+            cpp.batch_slippage(prices, volumes, starts, 10, "buy", 6)
+
+
+@pytest.mark.skipif(not CPP_AVAILABLE, reason="C++ module not available")
+class TestCppDataLoader:
+    def test_load_cleans_in_one_pass(self):
+        data = cpp.load_market_data(str(DATA_PATH))
+        report = data.report
+
+        assert report.rows == len(data.bars)
+        assert not data.has_volume.any(0, report.first_traded)
+        assert data.has_volume.count() == len(data.bars) - report.zero_volume_rows
+        assert not data.has_volume.test(0)
+        with pytest.raises(IndexError):
+            data.has_volume.test(len(data.has_volume))
+        assert data.bars.timestamps[report.first_traded] == 19500103
+        bits = data.has_volume.to_list()
+        assert len(bits) == len(data.bars)
+        assert sum(bits) == data.has_volume.count()
+
+        starts = [0, 100, report.first_traded, report.first_traded + 1000, 20_000]
+        clean = cpp.batch_slippage(data, starts, 10)
+        raw = cpp.batch_slippage(list(data.bars.close), list(data.bars.volume), starts, 10)
+        assert clean.vwap_bps == pytest.approx(raw.vwap_bps, abs=1e-9)
+
+    def test_native_load_matches_pandas(self):
+        native = load_data(DATA_PATH, native=True)
+        frame = load_data(DATA_PATH)
+
+        assert len(native) == len(frame)
+        assert (native["Date"] == frame["Date"]).all()
+        for column in ["Open", "High", "Low", "Close", "Volume"]:
+            assert native[column].tolist() == pytest.approx(frame[column].tolist())
+        assert native["HasVolume"].tolist() == frame["HasVolume"].tolist()
+
+    def test_policies(self):
+        csv = "Date,Open,High,Low,Close,Volume\n2024-01-02,1,1,1,1,\n2024-01-03,2,2,2,,5\n"
+
+        data = cpp.parse_market_data(csv)
+        assert data.bars.volume[0] == 0.0
+        assert data.bars.close[1] == 1.0
+        assert data.report.nan_prices == 1
+
+        config = cpp.CleanConfig()
+        config.volume_nan = cpp.NanPolicy.DropRow
+        assert len(cpp.parse_market_data(csv, config).bars) == 1
+
+        with pytest.raises(ValueError):
+            cpp.parse_market_data("Date,Open,High,Low,Close,Volume\n2024-01-03,1,1,1,1,1\n2024-01-02,1,1,1,1,1\n")
@@ -1,3 +1,5 @@
+import pytest
+
 from execution_engine import DATA_PATH, load_data
 
 # AAA
@@ -8,3 +10,32 @@ class TestLoad:
         df = load_data(DATA_PATH)
 
         assert len(df) != 0
+
+    def test_load_data_is_clean(self):
+        df = load_data(DATA_PATH)
+
+        assert not df["Volume"].isna().any()
+        assert (df["Volume"] >= 0).all()
+        assert df["Date"].is_monotonic_increasing
+
+    def test_infinite_and_negative_volumes_are_missing(self, tmp_path):
+        path = tmp_path / "bars.csv"
+        path.write_text(
+            "Date,Close,High,Low,Open,Volume\n"
+            "2024-01-02,1,1,1,1,inf\n"
+            "2024-01-03,2,2,2,2,-5\n"
+            "2024-01-04,3,3,3,3,7\n"
+        )
+
+        df = load_data(path)
+
+        assert df["Volume"].tolist() == [0.0, 0.0, 7.0]
+        assert df["HasVolume"].tolist() == [False, False, True]
+
+    def test_native_needs_the_module(self):
+        from src.execution_engine.data import loader
+
+        if loader._cpp is not None:
+            pytest.skip("C++ module built: covered by bindings_test")
+        with pytest.raises(RuntimeError):
+            load_data(DATA_PATH, native=True)